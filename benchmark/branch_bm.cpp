@@ -0,0 +1,79 @@
+
+#include "benchmark/benchmark.h"
+#include <cmath>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/branch.hpp"
+#include "simd_access/simd_loop.hpp"
+
+namespace sa = simd_access;
+
+namespace
+{
+
+/// Flux across a shock, more expensive than the smooth flux.
+template<class T>
+T ShockFlux(const T& left, const T& right)
+{
+  using std::sqrt;
+  using stdx::sqrt;
+  return sqrt(left * right) * (right - left) / (left + right) + sqrt(left + right);
+}
+
+template<class T>
+T SmoothFlux(const T& left, const T& right)
+{
+  return 0.5 * (left + right);
+}
+
+/// Pressure field with shock regions of 64 cells every 1024 cells, i.e. 95% of the vectors are uniformly smooth.
+std::vector<double> PressureField(size_t size)
+{
+  std::vector<double> result(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    result[i] = 1.0 + (i % 1024 < 64 ? 3.0 * (i % 2) : 0.001 * (i % 7));
+  }
+  return result;
+}
+
+}
+
+template<bool SkipUniform>
+void Branch_ShockDetection(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  auto pressure = PressureField(arraySize + 1);
+  // pressure of the right neighbour cell
+  std::vector<double> rightPressure(pressure.begin() + 1, pressure.end());
+  std::vector<double> flux(arraySize);
+  for (auto _ : state)
+  {
+    sa::loop<vec_size>(0, arraySize, [&](auto i)
+      {
+        auto left = SIMD_ACCESS_V(pressure, i);
+        auto right = SIMD_ACCESS_V(rightPressure, i);
+        auto shock = right - left > 1.0 || left - right > 1.0;
+        if constexpr (SkipUniform)
+        {
+          SIMD_ACCESS(flux, i) = sa::branch(shock,
+            [&]() { return ShockFlux(left, right); },
+            [&]() { return SmoothFlux(left, right); });
+        }
+        else
+        {
+          auto result = SmoothFlux(left, right);
+          using sa::where;
+          where(shock, result) = ShockFlux(left, right);
+          SIMD_ACCESS(flux, i) = result;
+        }
+      });
+    benchmark::DoNotOptimize(flux.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+BENCHMARK(Branch_ShockDetection<false>)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
+BENCHMARK(Branch_ShockDetection<true>)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
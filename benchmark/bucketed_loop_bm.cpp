@@ -0,0 +1,112 @@
+
+#include "benchmark/benchmark.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/bucketed_loop.hpp"
+
+namespace sa = simd_access;
+
+namespace
+{
+
+/// Boundary conditions, which compute the flux of a boundary face from the state of its cell.
+struct BoundaryCondition
+{
+  virtual ~BoundaryCondition() = default;
+  virtual int kind() const = 0;
+  virtual double apply(double state) const = 0;
+};
+
+template<int Kind>
+auto BoundaryFlux(const auto& state)
+{
+  if constexpr (Kind == 0)
+  {
+    // wall
+    return 0.0 * state;
+  }
+  else if constexpr (Kind == 1)
+  {
+    // inflow
+    return 2.0 - 0.5 * state;
+  }
+  else
+  {
+    // outflow
+    return state * state * 0.25 + state;
+  }
+}
+
+template<int Kind>
+struct TypedBoundaryCondition : BoundaryCondition
+{
+  int kind() const override { return Kind; }
+  double apply(double state) const override { return BoundaryFlux<Kind>(state); }
+};
+
+/// Boundary faces in random order of their types.
+std::vector<std::unique_ptr<BoundaryCondition>> BoundaryFaces(size_t size)
+{
+  std::vector<std::unique_ptr<BoundaryCondition>> result;
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<int> distribution(0, 2);
+  for (size_t i = 0; i < size; ++i)
+  {
+    switch (distribution(generator))
+    {
+      case 0:
+        result.push_back(std::make_unique<TypedBoundaryCondition<0>>());
+        break;
+      case 1:
+        result.push_back(std::make_unique<TypedBoundaryCondition<1>>());
+        break;
+      default:
+        result.push_back(std::make_unique<TypedBoundaryCondition<2>>());
+        break;
+    }
+  }
+  return result;
+}
+
+}
+
+void Bucketed_VirtualBoundary(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  auto faces = BoundaryFaces(arraySize);
+  std::vector<double> cellState(arraySize, 1.5), flux(arraySize);
+  for (auto _ : state)
+  {
+    for (int i = 0; i < arraySize; ++i)
+    {
+      flux[i] = faces[i]->apply(cellState[i]);
+    }
+    benchmark::DoNotOptimize(flux.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+void Bucketed_BucketedBoundary(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  auto faces = BoundaryFaces(arraySize);
+  std::vector<double> cellState(arraySize, 1.5), flux(arraySize);
+  // the buckets are built once and reused in every time step
+  sa::type_buckets<3> buckets(0, int(arraySize), [&](auto i) { return faces[i]->kind(); });
+  for (auto _ : state)
+  {
+    sa::bucketed_loop<vec_size>(buckets, [&](auto kind, auto i)
+      {
+        SIMD_ACCESS(flux, i) = BoundaryFlux<decltype(kind)::value>(SIMD_ACCESS_V(cellState, i));
+      });
+    benchmark::DoNotOptimize(flux.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+BENCHMARK(Bucketed_VirtualBoundary)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
+BENCHMARK(Bucketed_BucketedBoundary)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
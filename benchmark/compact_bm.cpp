@@ -0,0 +1,65 @@
+#include "benchmark/benchmark.h"
+#include <random>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/compact.hpp"
+
+namespace sa = simd_access;
+
+namespace
+{
+
+/// Pressures, of which about half are negative in random order.
+std::vector<double> RandomPressure(size_t size)
+{
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::vector<double> result(size);
+  for (auto& p : result)
+  {
+    p = distribution(generator);
+  }
+  return result;
+}
+
+}
+
+/// The list is built by a scalar loop with a branch per element.
+static void Compact_Scalar(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  auto pressure = RandomPressure(arraySize);
+  std::vector<int> negative(arraySize);
+  for (auto _ : state)
+  {
+    int* out = negative.data();
+    for (int i = 0; i < arraySize; ++i)
+    {
+      if (pressure[i] < 0.0)
+      {
+        *out++ = i;
+      }
+    }
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+static void Compact_Vectorized(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  auto pressure = RandomPressure(arraySize);
+  std::vector<int> negative(arraySize);
+  for (auto _ : state)
+  {
+    int* out = sa::compact<vec_size>(0, arraySize,
+      [&](auto i) { return SIMD_ACCESS_V(pressure, i) < 0.0; }, negative.data());
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+BENCHMARK(Compact_Scalar)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
+BENCHMARK(Compact_Vectorized)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
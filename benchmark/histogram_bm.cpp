@@ -0,0 +1,64 @@
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/histogram.hpp"
+
+namespace sa = simd_access;
+
+namespace
+{
+
+constexpr int binCount = 16;
+
+/// Mach numbers, which are concentrated around 0.8 like in a transonic flow.
+std::vector<double> MachNumbers(size_t size)
+{
+  std::mt19937 generator(1);
+  std::normal_distribution<double> distribution(0.8, 0.1);
+  std::vector<double> result(size);
+  for (auto& m : result)
+  {
+    m = std::clamp(distribution(generator), 0.0, 1.59);
+  }
+  return result;
+}
+
+}
+
+/// The bins are counted by a scalar loop.
+static void Histogram_Scalar(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  auto mach = MachNumbers(arraySize);
+  std::vector<int> counts(binCount);
+  for (auto _ : state)
+  {
+    for (int i = 0; i < arraySize; ++i)
+    {
+      ++counts[int(mach[i] * 10.0)];
+    }
+    benchmark::DoNotOptimize(counts.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+static void Histogram_Vectorized(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  auto mach = MachNumbers(arraySize);
+  std::vector<int> counts(binCount);
+  for (auto _ : state)
+  {
+    sa::histogram<vec_size>(0, arraySize, [&](auto i) { return SIMD_ACCESS_V(mach, i) * 10.0; },
+      counts.data(), counts.size());
+    benchmark::DoNotOptimize(counts.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+BENCHMARK(Histogram_Scalar)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
+BENCHMARK(Histogram_Vectorized)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
@@ -0,0 +1,124 @@
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/interleave.hpp"
+
+namespace sa = simd_access;
+
+namespace {
+
+struct ChainNode
+{
+  const ChainNode* next_;
+  double value_;
+};
+
+constexpr size_t chainLength = 64;
+
+/// Nodes linked in random order to chains of `chainLength` nodes.
+struct LinkedChains
+{
+  std::vector<ChainNode> nodes_;
+  std::vector<const ChainNode*> heads_;
+
+  explicit LinkedChains(size_t nodeCount) :
+    nodes_(nodeCount)
+  {
+    std::vector<size_t> order(nodeCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(1));
+    for (size_t c = 0; c < nodeCount / chainLength; ++c)
+    {
+      heads_.push_back(&nodes_[order[c * chainLength]]);
+      for (size_t k = 0; k < chainLength; ++k)
+      {
+        auto& node = nodes_[order[c * chainLength + k]];
+        node.value_ = 1.0;
+        node.next_ = k + 1 < chainLength ? &nodes_[order[c * chainLength + k + 1]] : nullptr;
+      }
+    }
+  }
+};
+
+}
+
+void Interleave_ScalarChase(benchmark::State& state)
+{
+  LinkedChains chains(state.range(0));
+  std::vector<double> sums(chains.heads_.size());
+  for (auto _ : state)
+  {
+    for (size_t c = 0; c < chains.heads_.size(); ++c)
+    {
+      double sum = 0;
+      for (auto node = chains.heads_[c]; node != nullptr; node = node->next_)
+      {
+        sum += node->value_;
+      }
+      sums[c] = sum;
+    }
+    benchmark::DoNotOptimize(sums.data());
+  }
+  state.SetItemsProcessed(chains.nodes_.size() * state.iterations());
+}
+
+void Interleave_UniversalChase(benchmark::State& state)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  LinkedChains chains(state.range(0));
+  std::vector<double> sums(chains.heads_.size());
+  for (auto _ : state)
+  {
+    sa::loop<vec_size>(size_t(0), chains.heads_.size(), [&](auto i)
+      {
+        auto node = sa::generate_universal(i, [&](auto k) { return chains.heads_[k]; });
+        auto sum = SIMD_ACCESS(sums, i) * 0;
+        for (size_t k = 0; k < chainLength; ++k)
+        {
+          sum += SIMD_UNIVERSAL_ACCESS(node, ->value_);
+          node = SIMD_UNIVERSAL_ACCESS(node, ->next_);
+        }
+        SIMD_ACCESS(sums, i) = sum;
+      });
+    benchmark::DoNotOptimize(sums.data());
+  }
+  state.SetItemsProcessed(chains.nodes_.size() * state.iterations());
+}
+
+template<int SimdSize, int Groups>
+void Interleave_InterleavedChase(benchmark::State& state)
+{
+  LinkedChains chains(state.range(0));
+  std::vector<double> sums(chains.heads_.size());
+  auto body = [&](auto i) -> sa::interleaved_task
+    {
+      auto node = sa::generate_universal(i, [&](auto k) { return chains.heads_[k]; });
+      auto sum = SIMD_ACCESS(sums, i) * 0;
+      for (size_t k = 0; k < chainLength; ++k)
+      {
+        node = co_await sa::fetch(node);
+        sum += SIMD_UNIVERSAL_ACCESS(node, ->value_);
+        node = SIMD_UNIVERSAL_ACCESS(node, ->next_);
+      }
+      SIMD_ACCESS(sums, i) = sum;
+    };
+  for (auto _ : state)
+  {
+    sa::interleaved_loop<SimdSize, Groups>(size_t(0), chains.heads_.size(), body);
+    benchmark::DoNotOptimize(sums.data());
+  }
+  state.SetItemsProcessed(chains.nodes_.size() * state.iterations());
+}
+
+#define BM_CHASE( ... ) BENCHMARK( __VA_ARGS__ )->Unit(benchmark::kMillisecond)->Arg(1 << 14)->Arg(1 << 22)
+
+BM_CHASE(Interleave_ScalarChase);
+BM_CHASE(Interleave_UniversalChase);
+BM_CHASE(Interleave_InterleavedChase<1, 8>);
+BM_CHASE(Interleave_InterleavedChase<1, 16>);
+BM_CHASE(Interleave_InterleavedChase<stdx::native_simd<double>::size(), 2>);
+BM_CHASE(Interleave_InterleavedChase<stdx::native_simd<double>::size(), 4>);
@@ -1,10 +1,14 @@
 
 #include "benchmark/benchmark.h"
-#include <vector>
+#include <algorithm>
 #include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
 
 #include "helper_bm.hpp"
 #include "simd_access/simd_access.hpp"
+#include "simd_access/access_plan.hpp"
 
 #if (1)
 #define CHECK_RESULT(...)
@@ -131,6 +135,150 @@ void Loop_LinearScalarReadAccess(benchmark::State& state)
   state.SetBytesProcessed(arraySize * (sizeof(double)) * state.iterations());
 }
 
+// Indices of a locally ordered mesh: runs of 64 consecutive indices, whose order is shuffled.
+std::vector<int> LocallyOrderedIndices(size_t size)
+{
+  std::vector<int> blocks((size + 63) / 64);
+  std::iota(blocks.begin(), blocks.end(), 0);
+  std::shuffle(blocks.begin(), blocks.end(), std::mt19937(1));
+  std::vector<int> indices;
+  for (auto block : blocks)
+  {
+    for (int i = block * 64; i < std::min(int(size), block * 64 + 64); ++i)
+    {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+void Loop_IndirectUpdate(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<double> testData(arraySize);
+  GenerateNWithIndex(testData.begin(), arraySize, [](auto i) { return double(i + 1); });
+  auto indices = LocallyOrderedIndices(arraySize);
+  HeatCache(testData);
+  for (auto _ : state)
+  {
+    simd_access::loop<vec_size>(indices.begin(), indices.end(), [&](auto i)
+      {
+        SIMD_ACCESS(testData, i) = SIMD_ACCESS(testData, i) * 0.5 + 1.0;
+      });
+    benchmark::DoNotOptimize(testData.data());
+  }
+  state.SetBytesProcessed(arraySize * (sizeof(double)) * state.iterations());
+}
+
+void Loop_ClassifyingIndirectUpdate(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<double> testData(arraySize);
+  GenerateNWithIndex(testData.begin(), arraySize, [](auto i) { return double(i + 1); });
+  auto indices = LocallyOrderedIndices(arraySize);
+  HeatCache(testData);
+  simd_access::access_statistics statistics;
+  for (auto _ : state)
+  {
+    simd_access::classifying_loop<vec_size>(indices.begin(), indices.end(), [&](auto i)
+      {
+        SIMD_ACCESS(testData, i) = SIMD_ACCESS(testData, i) * 0.5 + 1.0;
+      }, &statistics);
+    benchmark::DoNotOptimize(testData.data());
+  }
+  state.counters["contiguous"] = double(statistics.contiguous) / double(statistics.vectors());
+  state.counters["strided"] = double(statistics.strided) / double(statistics.vectors());
+  state.counters["gathered"] = double(statistics.gathered) / double(statistics.vectors());
+  state.SetBytesProcessed(arraySize * (sizeof(double)) * state.iterations());
+}
+
+void Loop_PlannedIndirectUpdate(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<double> testData(arraySize);
+  GenerateNWithIndex(testData.begin(), arraySize, [](auto i) { return double(i + 1); });
+  auto indices = LocallyOrderedIndices(arraySize);
+  simd_access::access_plan<vec_size> plan(indices.begin(), indices.end());
+  HeatCache(testData);
+  for (auto _ : state)
+  {
+    simd_access::loop<vec_size>(plan, [&](auto i)
+      {
+        SIMD_ACCESS(testData, i) = SIMD_ACCESS(testData, i) * 0.5 + 1.0;
+      });
+    benchmark::DoNotOptimize(testData.data());
+  }
+  state.SetBytesProcessed(arraySize * (sizeof(double)) * state.iterations());
+}
+
+template<class IndexType>
+void Loop_ShuffledIndirectUpdate(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<double> testData(arraySize);
+  GenerateNWithIndex(testData.begin(), arraySize, [](auto i) { return double(i + 1); });
+  std::vector<size_t> wideIndices(arraySize);
+  std::iota(wideIndices.begin(), wideIndices.end(), 0);
+  std::shuffle(wideIndices.begin(), wideIndices.end(), std::mt19937(1));
+  auto indices = simd_access::narrow_indices<IndexType>(wideIndices.begin(), wideIndices.end());
+  HeatCache(testData);
+  HeatCache(indices);
+  for (auto _ : state)
+  {
+    simd_access::loop<vec_size>(indices.begin(), indices.end(), [&](auto i)
+      {
+        SIMD_ACCESS(testData, i) = SIMD_ACCESS(testData, i) * 0.5 + 1.0;
+      });
+    benchmark::DoNotOptimize(testData.data());
+  }
+  state.SetBytesProcessed(arraySize * (sizeof(double) + sizeof(IndexType)) * state.iterations());
+}
+
+// Latency-bound gather through shuffled indices, the intended regime of pipelined_loop with Steps > 0. The largest
+// case (80 MB) exceeds the last-level cache of most machines, but still runs on ordinary CI machines.
+template<int Distance, int Steps = 0>
+void Loop_RandomGather(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<double> testData(arraySize);
+  GenerateNWithIndex(testData.begin(), arraySize, [](auto i) { return double(i + 1); });
+  std::vector<int> indices(arraySize);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::shuffle(indices.begin(), indices.end(), std::mt19937(1));
+  std::vector<double> result(arraySize);
+  for (auto _ : state)
+  {
+    auto body = [&](auto i)
+      {
+        auto x = SIMD_ACCESS(testData, i) * 1.0;
+        // optional dependent computation, which the prefetches of the following iterations overlap with
+        for (int step = 0; step < Steps; ++step)
+        {
+          x = x * 0.5 + 1.0;
+        }
+        SIMD_ACCESS(result, i) = x * x + 1.0;
+      };
+    if constexpr (Distance > 0)
+    {
+      simd_access::pipelined_loop<vec_size, Distance>(indices.begin(), indices.end(), body, [&](const auto& i)
+        {
+          simd_access::prefetch(SIMD_ACCESS(testData, i));
+        });
+    }
+    else
+    {
+      simd_access::loop<vec_size>(indices.begin(), indices.end(), body);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetBytesProcessed(arraySize * (sizeof(double) + sizeof(int)) * state.iterations());
+}
+
 #define BM_READ( name ) BENCHMARK( name )->Unit(benchmark::kMicrosecond)->Arg(100)->Arg(4000)
 
 BM_READ(Loop_IntrinsicScatteredSimdReadAccess);
@@ -138,3 +286,14 @@ BM_READ(Loop_ScatteredSimdReadAccess);
 BM_READ(Loop_LinearSimdReadAccess);
 BM_READ(Loop_LinearInlinedSimdReadAccess);
 BM_READ(Loop_LinearScalarReadAccess);
+BM_READ(Loop_IndirectUpdate);
+BM_READ(Loop_ClassifyingIndirectUpdate);
+BM_READ(Loop_PlannedIndirectUpdate);
+BENCHMARK(Loop_ShuffledIndirectUpdate<std::int64_t>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 22);
+BENCHMARK(Loop_ShuffledIndirectUpdate<std::int32_t>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 22);
+BENCHMARK(Loop_RandomGather<0>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 22);
+BENCHMARK(Loop_RandomGather<2>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 22);
+BENCHMARK(Loop_RandomGather<4>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 22);
+BENCHMARK(Loop_RandomGather<8>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 22);
+BENCHMARK(Loop_RandomGather<0, 16>)->Unit(benchmark::kMicrosecond)->Arg(1 << 22);
+BENCHMARK(Loop_RandomGather<4, 16>)->Unit(benchmark::kMicrosecond)->Arg(1 << 22);
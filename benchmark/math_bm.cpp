@@ -0,0 +1,114 @@
+
+#include "benchmark/benchmark.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/math.hpp"
+
+namespace sa = simd_access;
+
+namespace
+{
+
+struct Exp
+{
+  static constexpr double lower = -50, upper = 50;
+  template<sa::math_accuracy Accuracy>
+  static auto vectorized(const auto& x) { return sa::exp<Accuracy>(x); }
+  static auto scalar(auto x) { return std::exp(x); }
+};
+
+struct Log
+{
+  static constexpr double lower = 1e-3, upper = 1e3;
+  template<sa::math_accuracy Accuracy>
+  static auto vectorized(const auto& x) { return sa::log<Accuracy>(x); }
+  static auto scalar(auto x) { return std::log(x); }
+};
+
+struct Pow
+{
+  static constexpr double lower = 0.1, upper = 10;
+  template<sa::math_accuracy Accuracy>
+  static auto vectorized(const auto& x) { return sa::pow<Accuracy>(x, 2.4); }
+  static auto scalar(auto x) { return std::pow(x, decltype(x)(2.4)); }
+};
+
+struct Erf
+{
+  static constexpr double lower = -3, upper = 3;
+  template<sa::math_accuracy Accuracy>
+  static auto vectorized(const auto& x) { return sa::erf<Accuracy>(x); }
+  static auto scalar(auto x) { return std::erf(x); }
+};
+
+template<class T, class Function>
+std::vector<T> Arguments(size_t size)
+{
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<T> distribution(T(Function::lower), T(Function::upper));
+  std::vector<T> result(size);
+  for (auto& v : result)
+  {
+    v = distribution(generator);
+  }
+  return result;
+}
+
+}
+
+/// The scalar function is called for every lane of the simd values.
+template<class T, class Function>
+void Math_Elementwise(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<T>::size();
+  auto x = Arguments<T, Function>(arraySize);
+  std::vector<T> result(arraySize);
+  for (auto _ : state)
+  {
+    sa::loop<vec_size>(0, arraySize, [&](auto i)
+      {
+        auto v = SIMD_ACCESS_V(x, i);
+        decltype(v) r;
+        sa::elementwise([](auto&& dest, auto&& src) { sa::element_write(dest) = Function::scalar(T(src)); }, r, v);
+        SIMD_ACCESS(result, i) = r;
+      });
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+template<class T, class Function, sa::math_accuracy Accuracy>
+void Math_Vectorized(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<T>::size();
+  auto x = Arguments<T, Function>(arraySize);
+  std::vector<T> result(arraySize);
+  for (auto _ : state)
+  {
+    sa::loop<vec_size>(0, arraySize, [&](auto i)
+      {
+        SIMD_ACCESS(result, i) = Function::template vectorized<Accuracy>(SIMD_ACCESS_V(x, i));
+      });
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+#define MATH_BENCHMARKS(T, Function) \
+  BENCHMARK(Math_Elementwise<T, Function>)->Unit(benchmark::kMicrosecond)->Arg(1 << 14); \
+  BENCHMARK(Math_Vectorized<T, Function, sa::math_accuracy::ulp1>)->Unit(benchmark::kMicrosecond)->Arg(1 << 14); \
+  BENCHMARK(Math_Vectorized<T, Function, sa::math_accuracy::ulp4>)->Unit(benchmark::kMicrosecond)->Arg(1 << 14);
+
+MATH_BENCHMARKS(double, Exp)
+MATH_BENCHMARKS(double, Log)
+MATH_BENCHMARKS(double, Pow)
+MATH_BENCHMARKS(double, Erf)
+MATH_BENCHMARKS(float, Exp)
+MATH_BENCHMARKS(float, Log)
+MATH_BENCHMARKS(float, Pow)
+MATH_BENCHMARKS(float, Erf)
@@ -0,0 +1,171 @@
+#include "benchmark/benchmark.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/refill_loop.hpp"
+
+namespace sa = simd_access;
+
+namespace {
+
+/// Cube root `x^3 = a`, which needs between 2 and about 40 Newton steps from a start value of 1 for `a` up to 1e8.
+struct CubeRoot
+{
+  static auto parameters(std::mt19937& generator)
+  {
+    return std::pow(10.0, std::uniform_real_distribution<double>(-1.0, 8.0)(generator));
+  }
+
+  static auto start(const auto& a)
+  {
+    return a * 0.0 + 1.0;
+  }
+
+  /// One Newton step. Returns the mask of converged lanes.
+  static auto step(auto& x, const auto& a)
+  {
+    x -= (x * x * x - a) / (3.0 * x * x);
+    return abs(x * x * x - a) <= 1e-12 * a;
+  }
+};
+
+/// Kepler's equation `x - e sin(x) = M` for the eccentricity `e = 0.99` solved with Newton's method from Danby's
+/// start value `x = M + 0.85 e`. The number of steps grows, when `M` approaches 0.
+struct Kepler
+{
+  static auto parameters(std::mt19937& generator)
+  {
+    return std::pow(10.0, std::uniform_real_distribution<double>(-6.0, 0.0)(generator));
+  }
+
+  static auto start(const auto& m)
+  {
+    return m + 0.85 * 0.99;
+  }
+
+  static auto step(auto& x, const auto& m)
+  {
+    auto residual = x - 0.99 * sin(x) - m;
+    x -= residual / (1.0 - 0.99 * cos(x));
+    return abs(residual) <= 1e-13;
+  }
+};
+
+/// Cube roots as above, but most parameters are close to 1, and every 16th element needs about 100 steps
+/// (parameters up to 1e30). In a plain loop the vectors with such an element run with a single active lane.
+struct StiffCubeRoot : CubeRoot
+{
+  static auto parameters(std::mt19937& generator)
+  {
+    auto stiff = std::uniform_int_distribution<int>(0, 15)(generator) == 0;
+    return std::pow(10.0, std::uniform_real_distribution<double>(stiff ? 25.0 : 0.0, stiff ? 30.0 : 1.0)(generator));
+  }
+};
+
+template<class Problem>
+std::vector<double> Problems(size_t size)
+{
+  std::vector<double> result(size);
+  std::mt19937 generator(1);
+  for (auto& parameter : result)
+  {
+    parameter = Problem::parameters(generator);
+  }
+  return result;
+}
+
+template<class T>
+struct SolverState
+{
+  T x, parameter;
+};
+
+}
+
+template<class Problem>
+void Refill_NewtonLoop(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  auto problems = Problems<Problem>(arraySize);
+  std::vector<double> roots(arraySize);
+  size_t steps = 0, activeLanes = 0;
+  for (auto _ : state)
+  {
+    sa::loop<vec_size>(0, arraySize, [&](auto i)
+      {
+        auto parameter = SIMD_ACCESS(problems, i) * 1.0;
+        auto x = Problem::start(parameter);
+        auto x_new = x;
+        auto converged = Problem::step(x_new, parameter);
+        if constexpr (sa::is_simd_index(i))
+        {
+          ++steps;
+          activeLanes += vec_size;
+          while (!stdx::all_of(converged))
+          {
+            ++steps;
+            activeLanes += vec_size - stdx::popcount(converged);
+            where(!converged, x) = x_new;
+            converged = converged || Problem::step(x_new, parameter);
+          }
+          where(!converged, x) = x_new;
+        }
+        else
+        {
+          while (!converged)
+          {
+            x = x_new;
+            converged = Problem::step(x_new, parameter);
+          }
+          x = x_new;
+        }
+        SIMD_ACCESS(roots, i) = x;
+      });
+    benchmark::DoNotOptimize(roots.data());
+  }
+  state.counters["utilization"] = double(activeLanes) / double(steps * vec_size);
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+// The lanes are refilled, when at most Quarters/4 of them are active.
+template<class Problem, int Quarters = 2>
+void Refill_NewtonRefillLoop(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  auto problems = Problems<Problem>(arraySize);
+  std::vector<double> roots(arraySize);
+  sa::refill_statistics statistics;
+  for (auto _ : state)
+  {
+    statistics = sa::refill_loop<vec_size, vec_size * Quarters / 4>(0l, arraySize,
+      [&](const auto& i)
+      {
+        auto parameter = SIMD_ACCESS(problems, i).to_simd();
+        return SolverState<decltype(parameter)>{Problem::start(parameter), parameter};
+      },
+      [&](auto& s)
+      {
+        return Problem::step(s.x, s.parameter);
+      },
+      [&](const auto& i, const auto& s, const auto& mask)
+      {
+        sa::where(mask, SIMD_ACCESS(roots, i)) = s.x;
+      });
+    benchmark::DoNotOptimize(roots.data());
+  }
+  state.counters["utilization"] = statistics.utilization();
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+BENCHMARK(Refill_NewtonLoop<CubeRoot>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 18);
+BENCHMARK(Refill_NewtonRefillLoop<CubeRoot>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 18);
+BENCHMARK(Refill_NewtonLoop<StiffCubeRoot>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 18);
+BENCHMARK(Refill_NewtonRefillLoop<StiffCubeRoot, 1>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 18);
+BENCHMARK(Refill_NewtonRefillLoop<StiffCubeRoot, 2>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 18);
+BENCHMARK(Refill_NewtonRefillLoop<StiffCubeRoot, 3>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 18);
+BENCHMARK(Refill_NewtonLoop<Kepler>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 18);
+BENCHMARK(Refill_NewtonRefillLoop<Kepler>)->Unit(benchmark::kMicrosecond)->Arg(4000)->Arg(1 << 18);
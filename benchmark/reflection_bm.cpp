@@ -5,6 +5,7 @@
 
 #include "simd_access/simd_access.hpp"
 #include "simd_access/simd_loop.hpp"
+#include "simd_access/lazy_access.hpp"
 
 namespace sa = simd_access;
 
@@ -67,5 +68,108 @@ void ReflectionScalar(benchmark::State& state)
   }
 }
 
+// dense node state without reflection hooks, accessed through an index array
+template<class T>
+struct NodeState
+{
+  T rho;
+  T momentum[3];
+  T energy;
+};
+
+void ReflectionIndexedSimd(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<NodeState<double>> x(arraySize, NodeState<double>{ 1.0, { 2.0, 3.0, 4.0 }, 5.0 }), z(arraySize);
+  std::vector<int> indices(arraySize);
+  for (int i = 0; i < arraySize; ++i)
+  {
+    indices[i] = (i * 7) % arraySize;
+  }
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(x.data());
+    simd_access::loop<vec_size>(0, z.size(), [&](auto i)
+    {
+      auto idx = SIMD_ACCESS_V(indices, i);
+      auto s = SIMD_ACCESS_V(x, idx);
+      s.energy += s.rho * s.momentum[0];
+      SIMD_ACCESS(z, idx) = s;
+    });
+    benchmark::DoNotOptimize(z.data());
+  }
+}
+
+void ReflectionIndexedScalar(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  std::vector<NodeState<double>> x(arraySize, NodeState<double>{ 1.0, { 2.0, 3.0, 4.0 }, 5.0 }), z(arraySize);
+  std::vector<int> indices(arraySize);
+  for (int i = 0; i < arraySize; ++i)
+  {
+    indices[i] = (i * 7) % arraySize;
+  }
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(x.data());
+    for (size_t i = 0; i < z.size(); ++i)
+    {
+      auto s = x[indices[i]];
+      s.energy += s.rho * s.momentum[0];
+      z[indices[i]] = s;
+    }
+    benchmark::DoNotOptimize(z.data());
+  }
+}
+
+// wide structure, of which a loop uses only two members
+template<class T>
+struct WideState
+{
+  T values[14];
+  T rho;
+  T energy;
+};
+
+void ReflectionEager(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<WideState<double>> x(arraySize, WideState<double>{ {}, 1.0, 2.0 });
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(x.data());
+    simd_access::loop<vec_size>(0, x.size(), [&](auto i)
+    {
+      auto s = SIMD_ACCESS_V(x, i);
+      s.energy += s.rho;
+      SIMD_ACCESS(x, i) = s;
+    });
+    benchmark::DoNotOptimize(x.data());
+  }
+}
+
+void ReflectionLazy(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<WideState<double>> x(arraySize, WideState<double>{ {}, 1.0, 2.0 });
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(x.data());
+    simd_access::loop<vec_size>(0, x.size(), [&](auto i)
+    {
+      auto s = simd_access::lazy(SIMD_ACCESS(x, i));
+      s.modify([](auto& v) -> auto& { return v.energy; }) += s.get([](auto& v) -> auto& { return v.rho; });
+    });
+    benchmark::DoNotOptimize(x.data());
+  }
+}
+
 BENCHMARK(ReflectionSimd)->Arg(16);
 BENCHMARK(ReflectionScalar)->Arg(16);
+BENCHMARK(ReflectionIndexedSimd)->Arg(1024);
+BENCHMARK(ReflectionIndexedScalar)->Arg(1024);
+BENCHMARK(ReflectionEager)->Arg(1024);
+BENCHMARK(ReflectionLazy)->Arg(1024);
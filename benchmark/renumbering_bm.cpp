@@ -0,0 +1,107 @@
+
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "helper_bm.hpp"
+#include "simd_access/simd_access.hpp"
+#include "simd_access/gather_cache.hpp"
+#include "simd_access/renumbering.hpp"
+
+namespace {
+
+enum class Numbering { Random, ReverseCuthillMcKee, Hilbert };
+
+// Edges and node values of a square grid with a given node numbering.
+struct GridMesh
+{
+  std::vector<int> first, second;
+  std::vector<double> values;
+
+  GridMesh(int width, Numbering numbering)
+  {
+    std::vector<int> nodes(width * width);
+    std::iota(nodes.begin(), nodes.end(), 0);
+    std::shuffle(nodes.begin(), nodes.end(), std::mt19937(1));
+    std::vector<std::pair<int, int>> edges;
+    std::vector<std::array<double, 2>> coordinates(nodes.size());
+    for (int y = 0; y < width; ++y)
+    {
+      for (int x = 0; x < width; ++x)
+      {
+        coordinates[nodes[y * width + x]] = { double(x), double(y) };
+        if (x + 1 < width)
+        {
+          edges.emplace_back(nodes[y * width + x], nodes[y * width + x + 1]);
+        }
+        if (y + 1 < width)
+        {
+          edges.emplace_back(nodes[y * width + x], nodes[(y + 1) * width + x]);
+        }
+      }
+    }
+    if (numbering != Numbering::Random)
+    {
+      auto order = numbering == Numbering::Hilbert ? simd_access::hilbert_order(coordinates) :
+        simd_access::reverse_cuthill_mckee(nodes.size(), edges);
+      simd_access::renumber_nodes(edges, simd_access::inverse_permutation(order));
+    }
+    edges = simd_access::permute(edges, simd_access::edge_order(edges));
+    for (auto [a, b] : edges)
+    {
+      first.push_back(a);
+      second.push_back(b);
+    }
+    values.resize(nodes.size());
+    GenerateNWithIndex(values.begin(), values.size(), [](auto i) { return double(i % 7); });
+  }
+};
+
+}
+
+void Renumbering_EdgeGather(benchmark::State& state)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  GridMesh mesh(int(state.range(0)), Numbering(state.range(1)));
+  std::vector<double> differences(mesh.first.size());
+  for (auto _ : state)
+  {
+    simd_access::loop<vec_size>(size_t(0), mesh.first.size(), [&](auto i)
+      {
+        auto a = SIMD_ACCESS_V(mesh.first, i);
+        auto b = SIMD_ACCESS_V(mesh.second, i);
+        SIMD_ACCESS(differences, i) = SIMD_ACCESS_V(mesh.values, a) - SIMD_ACCESS_V(mesh.values, b);
+      });
+    benchmark::DoNotOptimize(differences.data());
+  }
+  // gathered bytes
+  state.SetBytesProcessed(mesh.first.size() * 2 * sizeof(double) * state.iterations());
+}
+
+void Renumbering_CachedEdgeGather(benchmark::State& state)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  GridMesh mesh(int(state.range(0)), Numbering(state.range(1)));
+  std::vector<double> differences(mesh.first.size());
+  simd_access::gather_cache<double> cache;
+  for (auto _ : state)
+  {
+    cache.clear();
+    simd_access::loop<vec_size>(size_t(0), mesh.first.size(), [&](auto i)
+      {
+        auto a = SIMD_ACCESS_V(mesh.first, i);
+        auto b = SIMD_ACCESS_V(mesh.second, i);
+        SIMD_ACCESS(differences, i) = cache.load(SIMD_ACCESS(mesh.values, a)) - cache.load(SIMD_ACCESS(mesh.values, b));
+      });
+    benchmark::DoNotOptimize(differences.data());
+  }
+  state.counters["hit_rate"] = cache.hit_rate();
+  state.SetBytesProcessed(mesh.first.size() * 2 * sizeof(double) * state.iterations());
+}
+
+BENCHMARK(Renumbering_EdgeGather)->Unit(benchmark::kMicrosecond)->ArgsProduct({ { 64, 2048 }, { 0, 1, 2 } });
+BENCHMARK(Renumbering_CachedEdgeGather)->Unit(benchmark::kMicrosecond)->ArgsProduct({ { 64, 2048 }, { 0, 1 } });
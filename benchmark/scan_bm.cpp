@@ -0,0 +1,50 @@
+#include "benchmark/benchmark.h"
+#include <vector>
+
+#include "helper_bm.hpp"
+#include "simd_access/simd_access.hpp"
+#include "simd_access/scan.hpp"
+
+namespace sa = simd_access;
+
+/// Offsets of a CSR structure computed by a scalar loop.
+template<class T>
+void Scan_Scalar(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  std::vector<T> sizes(arraySize), offsets(arraySize + 1);
+  GenerateNWithIndex(sizes.begin(), arraySize, [](auto i) { return T(i % 7); });
+  for (auto _ : state)
+  {
+    T sum = 0;
+    for (int i = 0; i < arraySize; ++i)
+    {
+      offsets[i] = sum;
+      sum += sizes[i];
+    }
+    offsets[arraySize] = sum;
+    benchmark::DoNotOptimize(offsets.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+template<class T>
+void Scan_Vectorized(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<T>::size();
+  std::vector<T> sizes(arraySize), offsets(arraySize + 1);
+  GenerateNWithIndex(sizes.begin(), arraySize, [](auto i) { return T(i % 7); });
+  for (auto _ : state)
+  {
+    offsets[arraySize] = sa::exclusive_scan<vec_size>(0, arraySize,
+      [&](auto i) { return SIMD_ACCESS_V(sizes, i); }, offsets.data());
+    benchmark::DoNotOptimize(offsets.data());
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+BENCHMARK(Scan_Scalar<int>)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
+BENCHMARK(Scan_Vectorized<int>)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
+BENCHMARK(Scan_Scalar<double>)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
+BENCHMARK(Scan_Vectorized<double>)->Unit(benchmark::kMicrosecond)->Arg(1 << 16);
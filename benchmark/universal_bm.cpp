@@ -1,7 +1,10 @@
 
 #include "benchmark/benchmark.h"
-#include <vector>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include "simd_access/simd_access.hpp"
 #include "simd_access/simd_loop.hpp"
@@ -13,7 +16,7 @@ struct PointID
   double* data_;
   int     idx_;
 
-  auto GetValue() const { return data_[idx_]; }
+  const double& GetValue() const { return data_[idx_]; }
 };
 
 struct PointIDCollection
@@ -81,6 +84,127 @@ void UniversalScalarPure(benchmark::State& state)
   }
 }
 
-BENCHMARK(UniversalSimd)->Unit(benchmark::kMicrosecond)->Arg(32);
-BENCHMARK(UniversalScalar)->Unit(benchmark::kMicrosecond)->Arg(32);
-BENCHMARK(UniversalScalarPure)->Unit(benchmark::kMicrosecond)->Arg(32);
+struct Face
+{
+  int id_;
+  double area_;
+  double flux_;
+};
+
+/// Face pointers of a cell-to-face graph, which visits the faces in random order.
+std::vector<const Face*> ShuffledFacePointers(const std::vector<Face>& faces)
+{
+  std::vector<const Face*> result;
+  for (const auto& face : faces)
+  {
+    result.push_back(&face);
+  }
+  std::shuffle(result.begin(), result.end(), std::mt19937(1));
+  return result;
+}
+
+template<bool MemberGather>
+void UniversalPointerMember(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<Face> faces(arraySize);
+  for (int i = 0; i < arraySize; ++i)
+  {
+    faces[i] = Face{i, 1.0 + i, 0.5};
+  }
+  auto facePointers = ShuffledFacePointers(faces);
+  for (auto _ : state)
+  {
+    simd_access::loop<vec_size>(0, facePointers.size(), [&](auto i)
+      {
+        auto face = sa::generate_universal(i, [&](auto idx) { return facePointers[idx]; });
+        if constexpr (MemberGather)
+        {
+          auto result = sa::universal_member<&Face::area_>(face) * sa::universal_member<&Face::flux_>(face);
+          benchmark::DoNotOptimize(result);
+        }
+        else
+        {
+          auto result = SIMD_UNIVERSAL_ACCESS(face, ->area_) * SIMD_UNIVERSAL_ACCESS(face, ->flux_);
+          benchmark::DoNotOptimize(result);
+        }
+      });
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+void ScalarPointerMember(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  std::vector<Face> faces(arraySize);
+  for (int i = 0; i < arraySize; ++i)
+  {
+    faces[i] = Face{i, 1.0 + i, 0.5};
+  }
+  auto facePointers = ShuffledFacePointers(faces);
+  for (auto _ : state)
+  {
+    for (const auto* face : facePointers)
+    {
+      auto result = face->area_ * face->flux_;
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+/// Norm of the face values, whose square root is computed vectorized in the universal simd version.
+void UniversalPointerNorm(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<Face> faces(arraySize);
+  for (int i = 0; i < arraySize; ++i)
+  {
+    faces[i] = Face{i, 1.0 + i, 0.5};
+  }
+  auto facePointers = ShuffledFacePointers(faces);
+  for (auto _ : state)
+  {
+    simd_access::loop<vec_size>(0, facePointers.size(), [&](auto i)
+      {
+        auto face = sa::generate_universal(i, [&](auto idx) { return facePointers[idx]; });
+        auto area = sa::universal_member<&Face::area_>(face);
+        auto flux = sa::universal_member<&Face::flux_>(face);
+        using std::sqrt;
+        auto result = sqrt(area * area + flux * flux);
+        benchmark::DoNotOptimize(result);
+      });
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+void ScalarPointerNorm(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  std::vector<Face> faces(arraySize);
+  for (int i = 0; i < arraySize; ++i)
+  {
+    faces[i] = Face{i, 1.0 + i, 0.5};
+  }
+  auto facePointers = ShuffledFacePointers(faces);
+  for (auto _ : state)
+  {
+    for (const auto* face : facePointers)
+    {
+      auto result = std::sqrt(face->area_ * face->area_ + face->flux_ * face->flux_);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(arraySize * state.iterations());
+}
+
+BENCHMARK(UniversalSimd)->Unit(benchmark::kMicrosecond)->Arg(32)->Arg(4096);
+BENCHMARK(UniversalScalar)->Unit(benchmark::kMicrosecond)->Arg(32)->Arg(4096);
+BENCHMARK(UniversalScalarPure)->Unit(benchmark::kMicrosecond)->Arg(32)->Arg(4096);
+BENCHMARK(UniversalPointerMember<true>)->Unit(benchmark::kMicrosecond)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(UniversalPointerMember<false>)->Unit(benchmark::kMicrosecond)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(ScalarPointerMember)->Unit(benchmark::kMicrosecond)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(UniversalPointerNorm)->Unit(benchmark::kMicrosecond)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(ScalarPointerNorm)->Unit(benchmark::kMicrosecond)->Arg(4096)->Arg(1 << 20);
@@ -0,0 +1,123 @@
+#include "benchmark/benchmark.h"
+#include <memory>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/simd_loop.hpp"
+
+namespace sa = simd_access;
+
+namespace {
+
+// Counts the heap allocations of the simdized species vectors at their allocation point, i.e. the overflow storage of
+// an inline_vector or the storage of a std::vector.
+size_t allocationCounter = 0;
+
+template<class T>
+struct CountingAllocator
+{
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template<class U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(size_t n)
+  {
+    ++allocationCounter;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  bool operator==(const CountingAllocator&) const = default;
+};
+
+// The species mass fractions are simdized to an inline_vector (the default for std::vector members), which
+// allocates only for more than inline_capacity() species.
+template<class T, class VectorType = std::vector<T>>
+struct Species
+{
+  T temperature;
+  VectorType y;
+};
+
+template<int SimdSize, class T, class VectorType>
+inline auto simdized_value(const Species<T, VectorType>& s)
+{
+  using sa::simdized_value;
+  using SimdType = decltype(simdized_value<SimdSize>(s.temperature));
+  constexpr size_t capacity = sa::simdized_vector_capacity<typename VectorType::value_type>::value;
+  using SimdVectorType = sa::inline_vector<SimdType, capacity, CountingAllocator<SimdType>>;
+  return Species<SimdType, SimdVectorType>{ SimdType(), SimdVectorType(s.y.size()) };
+}
+
+template<sa::specialization_of<Species>... Args>
+inline void simd_members(auto&& func, Args&&... values)
+{
+  using sa::simd_members;
+  simd_members(func, values.temperature ...);
+  simd_members(func, values.y ...);
+}
+
+// The same structure, but simdized to a heap-allocated std::vector, whose allocations are counted.
+template<class T, class VectorType = std::vector<T>>
+struct HeapSpecies
+{
+  T temperature;
+  VectorType y;
+};
+
+template<int SimdSize, class T, class VectorType>
+inline auto simdized_value(const HeapSpecies<T, VectorType>& s)
+{
+  using sa::simdized_value;
+  using SimdType = decltype(simdized_value<SimdSize>(s.temperature));
+  using SimdVectorType = std::vector<SimdType, CountingAllocator<SimdType>>;
+  return HeapSpecies<SimdType, SimdVectorType>{ SimdType(), SimdVectorType(s.y.size()) };
+}
+
+template<sa::specialization_of<HeapSpecies>... Args>
+inline void simd_members(auto&& func, Args&&... values)
+{
+  using sa::simd_members;
+  simd_members(func, values.temperature ...);
+  simd_members(func, values.y ...);
+}
+
+template<template<class, class> class SpeciesType>
+void SpeciesTransport(benchmark::State& state)
+{
+  auto arraySize = state.range(0);
+  size_t numSpecies = state.range(1);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  std::vector<SpeciesType<double, std::vector<double>>> cells(arraySize);
+  for (auto& cell : cells)
+  {
+    cell.temperature = 300.;
+    cell.y.assign(numSpecies, 1. / numSpecies);
+  }
+  auto startCounter = allocationCounter;
+  for (auto _ : state)
+  {
+    sa::loop<vec_size>(0, cells.size(), [&](auto i)
+    {
+      auto cell = SIMD_ACCESS_V(cells, i);
+      for (size_t j = 0; j < numSpecies; ++j)
+      {
+        cell.y[j] = cell.y[j] * 0.5 + cell.temperature * 1e-6;
+      }
+      SIMD_ACCESS(cells, i) = cell;
+    });
+    benchmark::DoNotOptimize(cells.data());
+  }
+  // heap allocations per cell
+  state.counters["allocations"] =
+    benchmark::Counter(double(allocationCounter - startCounter) / arraySize, benchmark::Counter::kAvgIterations);
+}
+
+}
+
+// 5 species are stored inline, 12 species exceed the inline capacity of 8
+BENCHMARK_TEMPLATE(SpeciesTransport, Species)->Unit(benchmark::kMicrosecond)->Args({1000, 5})->Args({1000, 12});
+BENCHMARK_TEMPLATE(SpeciesTransport, HeapSpecies)->Unit(benchmark::kMicrosecond)->Args({1000, 5})->Args({1000, 12});
@@ -0,0 +1,254 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Index narrowing and access plans, which cache the analysis of an index range for repeated indirect loops.
+ */
+
+#ifndef SIMD_ACCESS_ACCESS_PLAN
+#define SIMD_ACCESS_ACCESS_PLAN
+
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "simd_access/base.hpp"
+#include "simd_access/index.hpp"
+#include "simd_access/simd_loop.hpp"
+
+namespace simd_access
+{
+
+/**
+ * Converts an index to a narrower integral type.
+ * @tparam NarrowIndexType Target index type.
+ * @param value Index.
+ * @return `value` converted to `NarrowIndexType`.
+ * @throw std::out_of_range If `value` doesn't fit into `NarrowIndexType`.
+ */
+template<std::integral NarrowIndexType>
+inline NarrowIndexType narrow_index(std::integral auto value)
+{
+  if (!std::in_range<NarrowIndexType>(value))
+  {
+    throw std::out_of_range("index " + std::to_string(value) + " exceeds " +
+      std::to_string(8 * sizeof(NarrowIndexType)) + " bit");
+  }
+  return NarrowIndexType(value);
+}
+
+/**
+ * Copies an index range into an array of narrower indices, usually 32 bit. Indirect loops over the result (see
+ * \ref loop) load half the index bytes of `size_t` or `int64_t` indices, and each index vector fits into half the
+ * register width. The accesses are unchanged, since a simd index of any integral type is accepted.
+ * @tparam NarrowIndexType Target index type.
+ * @tparam IteratorType Deduced type of the random access iterator defining the range of indices.
+ * @param start Inclusive start of the range of indices.
+ * @param end Exclusive end of the range of indices.
+ * @return The narrowed indices.
+ * @throw std::out_of_range If an index doesn't fit into `NarrowIndexType`.
+ */
+template<std::integral NarrowIndexType = std::int32_t, std::random_access_iterator IteratorType>
+inline std::vector<NarrowIndexType> narrow_indices(IteratorType start, const IteratorType& end)
+{
+  std::vector<NarrowIndexType> result;
+  result.reserve(end - start);
+  for (; start != end; ++start)
+  {
+    result.push_back(narrow_index<NarrowIndexType>(*start));
+  }
+  return result;
+}
+
+/// Access path of an index vector in an \ref access_plan.
+enum class access_kind : std::uint8_t
+{
+  /// The indices are consecutive (`idx[k] == idx[0] + k`). Accessed with a linear \ref index.
+  contiguous,
+  /// The indices have a constant stride other than one (`idx[k] == idx[0] + k * stride`). Accessed with a
+  /// \ref strided_index.
+  strided,
+  /// At least one index occurs more than once. The vector is executed lane by lane with scalar indices, so that
+  /// read-modify-write accesses (e.g. `+=`) give the same results as a sequential loop.
+  duplicated,
+  /// All other vectors. Accessed with a gather/scatter index.
+  general
+};
+
+/// The result of the analysis of an index range, which is reused by all loops over the range.
+/**
+ * Building a plan inspects every index vector once (classification, detection of duplicated indices, narrowing to
+ * 32 bit). Loops over the plan (see \ref loop(const access_plan<SimdSize>&, auto&&)) only dispatch on the cached
+ * decisions. This pays off for connectivity arrays, which don't change over many iterations.
+ *
+ * Index vectors with duplicated indices aren't vectorized, but executed lane by lane: a scatter of a read-modify-write
+ * access would keep only one of the updates of a duplicated index. Running only the conflict-free lanes as a vector
+ * would need a masked simd index, which the accesses don't support yet (see the TODO in index.hpp). Therefore the plan
+ * doesn't store conflict masks, and the classification of a vector stops at its first duplicated index.
+ * The indices are stored as `std::int32_t` element indices. Byte offsets depend on the size of the accessed elements,
+ * which differs between the arrays accessed in one loop, so they are still computed by the access.
+ * @tparam SimdSize Vector size.
+ */
+template<int SimdSize>
+class access_plan
+{
+public:
+  /// Type of the stored scalar indices.
+  using index_type = std::int32_t;
+
+  /// Cached decisions for one index vector.
+  struct vector_plan
+  {
+    /// Access path.
+    access_kind kind;
+    /// Distance between the indices of neighboring lanes (only meaningful for contiguous and strided vectors).
+    index_type stride;
+  };
+
+  /// Default constructor. Creates an empty plan.
+  access_plan() = default;
+
+  /// Analyzes an index range.
+  /**
+   * @tparam IteratorType Deduced type of the random access iterator defining the range of indices.
+   * @param start Inclusive start of the range of indices.
+   * @param end Exclusive end of the range of indices.
+   * @throw std::out_of_range If an index doesn't fit into `index_type`.
+   */
+  template<std::random_access_iterator IteratorType>
+  access_plan(IteratorType start, const IteratorType& end)
+  {
+    indices_ = narrow_indices<index_type>(start, end);
+    vectors_.reserve(indices_.size() / SimdSize);
+    for (size_t i = 0; i + SimdSize <= indices_.size(); i += SimdSize)
+    {
+      vectors_.push_back(classify(indices_.data() + i));
+    }
+  }
+
+  /// Number of indices.
+  size_t size() const { return indices_.size(); }
+  /// Number of full index vectors. The remaining `size() % SimdSize` indices are executed as scalars.
+  size_t vectors() const { return vectors_.size(); }
+  /// Returns the cached decisions for an index vector.
+  /**
+   * @param k Number of the vector, in the range [0, vectors()).
+   * @return The cached decisions.
+   */
+  const vector_plan& vector(size_t k) const { return vectors_[k]; }
+  /// Pointer to the (narrowed) indices.
+  const index_type* indices() const { return indices_.data(); }
+
+  /// Counts the vectors of an access path.
+  /**
+   * @param kind Access path.
+   * @return Number of vectors, which use `kind`.
+   */
+  size_t count(access_kind kind) const
+  {
+    size_t result = 0;
+    for (const auto& v : vectors_)
+    {
+      result += v.kind == kind;
+    }
+    return result;
+  }
+
+private:
+  /// Classifies the index vector starting at `idx`.
+  static vector_plan classify(const index_type* idx)
+  {
+    for (int k = 1; k < SimdSize; ++k)
+    {
+      for (int j = 0; j < k; ++j)
+      {
+        if (idx[j] == idx[k])
+        {
+          return { access_kind::duplicated, 0 };
+        }
+      }
+    }
+    // distances in 64 bit, since the difference of two 32 bit indices may overflow
+    std::int64_t stride = SimdSize > 1 ? std::int64_t(idx[1]) - idx[0] : 1;
+    bool progression = std::in_range<index_type>(stride);
+    for (int k = 2; k < SimdSize && progression; ++k)
+    {
+      progression = std::int64_t(idx[k]) - idx[k - 1] == stride;
+    }
+    if (!progression)
+    {
+      return { access_kind::general, 0 };
+    }
+    return { stride == 1 ? access_kind::contiguous : access_kind::strided, index_type(stride) };
+  }
+
+  /// The indices narrowed to `index_type`.
+  std::vector<index_type> indices_;
+  /// Cached decisions for every full index vector.
+  std::vector<vector_plan> vectors_;
+};
+
+/**
+ * Simd-ized iteration over a function using the cached decisions of an access plan. Contiguous vectors are passed as
+ * `index<SimdSize, std::int32_t>`, strided vectors as `strided_index<SimdSize, std::int32_t>` and general vectors as
+ * `stdx::fixed_size_simd<std::int32_t, SimdSize>`. Duplicated vectors and the remainder are executed with scalar
+ * `std::int32_t` indices.
+ * @tparam SimdSize Vector size. Must match the plan.
+ * @tparam Args Optional additional template arguments passed to the function call operator.
+ * @param plan The access plan of the index range.
+ * @param fn Generic function to be called. Takes one argument of one of the index types listed above.
+ */
+template<int SimdSize, auto ... Args>
+inline void loop(const access_plan<SimdSize>& plan, auto&& fn)
+{
+  using IndexType = typename access_plan<SimdSize>::index_type;
+  auto call = [&](const auto& idx)
+    {
+      if constexpr (sizeof...(Args) == 0)
+      {
+        fn(idx);
+      }
+      else
+      {
+        fn.template operator()<Args...>(idx);
+      }
+    };
+  const IndexType* indices = plan.indices();
+  size_t i = 0;
+  for (size_t k = 0, e = plan.vectors(); k < e; ++k, i += SimdSize)
+  {
+    const auto& v = plan.vector(k);
+    switch (v.kind)
+    {
+      case access_kind::contiguous:
+        call(index<SimdSize, IndexType>{indices[i]});
+        break;
+      case access_kind::strided:
+        call(strided_index<SimdSize, IndexType>{indices[i], v.stride});
+        break;
+      case access_kind::general:
+        call(stdx::fixed_size_simd<IndexType, SimdSize>(indices + i, stdx::element_aligned));
+        break;
+      case access_kind::duplicated:
+        for (int j = 0; j < SimdSize; ++j)
+        {
+          call(indices[i + j]);
+        }
+        break;
+    }
+  }
+  for (; i < plan.size(); ++i)
+  {
+    call(indices[i]);
+  }
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_ACCESS_PLAN
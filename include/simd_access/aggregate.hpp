@@ -0,0 +1,211 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Compile-time reflection of aggregates.
+ *
+ * The members of an aggregate are enumerated with structured bindings. The number of members is detected by
+ * testing, how many braced initializers the aggregate accepts. This doesn't require any user-written hooks, but works
+ * only for aggregates without base classes and with at most \ref max_aggregate_arity members.
+ */
+
+#ifndef SIMD_ACCESS_AGGREGATE
+#define SIMD_ACCESS_AGGREGATE
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "simd_access/base.hpp"
+
+namespace simd_access
+{
+
+/// Maximal number of members of an aggregate, which can be reflected automatically.
+constexpr size_t max_aggregate_arity = 16;
+
+///@cond
+// Implicitly converts to any member type. Used in unevaluated contexts only.
+struct any_member
+{
+  template<class T>
+  operator T() const;
+};
+
+template<class T, size_t... I>
+concept brace_initializable_from = requires { T{ { (I, any_member()) } ... }; };
+
+// Implicitly converts to the base classes of T only. Used in unevaluated contexts only.
+template<class T>
+struct any_base_of
+{
+  template<class U>
+    requires (std::is_base_of_v<U, T> && !std::is_same_v<U, T>)
+  operator U() const;
+};
+
+// The first initializer of an aggregate initializes its first base class, if it has any.
+template<class T>
+concept aggregate_with_bases = requires { T{ any_base_of<T>() }; };
+
+template<class T, size_t Count>
+consteval size_t count_aggregate_members()
+{
+  if constexpr (Count > max_aggregate_arity)
+  {
+    return Count;
+  }
+  else if constexpr ([]<size_t... I>(std::index_sequence<I...>)
+    {
+      return brace_initializable_from<T, I...>;
+    }(std::make_index_sequence<Count + 1>()))
+  {
+    return count_aggregate_members<T, Count + 1>();
+  }
+  else
+  {
+    return Count;
+  }
+}
+///@endcond
+
+/// Number of members of an aggregate.
+/**
+ * Every member is tested with its own braced initializer, thus array members count as one member. Counting stops
+ * at the first member, which is list-initialized ambiguously from a value of unknown type (e.g. \ref inline_vector).
+ * @tparam T Aggregate type.
+ */
+template<class T>
+constexpr size_t aggregate_arity = count_aggregate_members<std::remove_cvref_t<T>, 0>();
+
+/// Aggregates, whose members can be enumerated automatically.
+/**
+ * Tuple-like types (e.g. `std::array`) and simd types are excluded, since they are decomposed differently. Aggregates
+ * with base classes are excluded, since their braced initializers don't correspond to their structured bindings.
+ */
+template<class T>
+concept reflectable_aggregate =
+  std::is_class_v<std::remove_cvref_t<T>> && std::is_aggregate_v<std::remove_cvref_t<T>> &&
+  (!any_simd<T>) && (!requires { std::tuple_size<std::remove_cvref_t<T>>::value; }) &&
+  (!aggregate_with_bases<std::remove_cvref_t<T>>) && aggregate_arity<T> <= max_aggregate_arity;
+
+/**
+ * Returns a tuple of references to the members of an aggregate.
+ * @tparam T Deduced aggregate type (possibly const).
+ * @tparam Arity Number of members. Must be given explicitly for aggregates, whose members have ambiguous constructors
+ *   (e.g. \ref inline_vector), since \ref aggregate_arity undercounts them.
+ * @param value The aggregate.
+ * @return `std::tuple` of lvalue references to all members in declaration order.
+ */
+template<reflectable_aggregate T, size_t Arity = aggregate_arity<T>>
+inline auto tie_members(T& value)
+{
+  if constexpr (Arity == 0)
+  {
+    return std::tuple<>();
+  }
+  else if constexpr (Arity == 1)
+  {
+    auto& [m0] = value;
+    return std::tie(m0);
+  }
+  else if constexpr (Arity == 2)
+  {
+    auto& [m0, m1] = value;
+    return std::tie(m0, m1);
+  }
+  else if constexpr (Arity == 3)
+  {
+    auto& [m0, m1, m2] = value;
+    return std::tie(m0, m1, m2);
+  }
+  else if constexpr (Arity == 4)
+  {
+    auto& [m0, m1, m2, m3] = value;
+    return std::tie(m0, m1, m2, m3);
+  }
+  else if constexpr (Arity == 5)
+  {
+    auto& [m0, m1, m2, m3, m4] = value;
+    return std::tie(m0, m1, m2, m3, m4);
+  }
+  else if constexpr (Arity == 6)
+  {
+    auto& [m0, m1, m2, m3, m4, m5] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5);
+  }
+  else if constexpr (Arity == 7)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6);
+  }
+  else if constexpr (Arity == 8)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7);
+  }
+  else if constexpr (Arity == 9)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8);
+  }
+  else if constexpr (Arity == 10)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9);
+  }
+  else if constexpr (Arity == 11)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
+  }
+  else if constexpr (Arity == 12)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
+  }
+  else if constexpr (Arity == 13)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
+  }
+  else if constexpr (Arity == 14)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
+  }
+  else if constexpr (Arity == 15)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
+  }
+  else if constexpr (Arity == 16)
+  {
+    auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = value;
+    return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
+  }
+}
+
+/// Tuple of the types of the members of an aggregate.
+/**
+ * @tparam T Aggregate type.
+ */
+template<reflectable_aggregate T>
+using aggregate_member_types =
+  decltype(std::apply([](auto&... members) { return std::tuple<std::remove_cvref_t<decltype(members)>...>(); },
+    tie_members(std::declval<std::remove_cvref_t<T>&>())));
+
+/// Checks, whether an aggregate has no padding bytes between or after its members.
+/**
+ * @tparam T Aggregate type.
+ */
+template<reflectable_aggregate T>
+constexpr bool aggregate_without_padding = []<class... Members>(std::tuple<Members...>*)
+  {
+    return std::is_standard_layout_v<std::remove_cvref_t<T>> &&
+      (size_t(0) + ... + sizeof(Members)) == sizeof(std::remove_cvref_t<T>);
+  }(static_cast<aggregate_member_types<T>*>(nullptr));
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_AGGREGATE
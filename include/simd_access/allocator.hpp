@@ -0,0 +1,150 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief An allocator for large arrays, which skips value-initialization and requests transparent huge pages.
+ */
+
+#ifndef SIMD_ACCESS_ALLOCATOR
+#define SIMD_ACCESS_ALLOCATOR
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace simd_access
+{
+
+/// Size of a transparent huge page (2 MB on x86-64).
+constexpr size_t huge_page_size = size_t(1) << 21;
+
+/// Allocator for large arrays of simd-accessed data.
+/**
+ * The allocator differs from `std::allocator` in two aspects:
+ * 1. Elements constructed without arguments are default-initialized instead of value-initialized. Thus, resizing a
+ *   container of arithmetic values doesn't touch the memory. The first write can then happen in the (possibly
+ *   parallel) loop, which computes the values, so that the pages are placed on the NUMA node of the writing thread.
+ * 2. Allocations of at least `HugePageThreshold` bytes are aligned to `huge_page_size` and marked as candidates for
+ *   transparent huge pages (`madvise(MADV_HUGEPAGE)`), which reduces TLB misses for large gathers. On systems
+ *   without `MADV_HUGEPAGE` only the alignment is applied.
+ * @tparam T Value type.
+ * @tparam HugePageThreshold Minimal size in bytes of an allocation, for which huge pages are requested.
+ */
+template<class T, size_t HugePageThreshold = huge_page_size>
+struct huge_page_allocator
+{
+  /// Type of the allocated elements.
+  using value_type = T;
+
+  /// Rebinds the allocator to another value type (required because of the non-type template parameter).
+  /**
+   * @tparam U New value type.
+   */
+  template<class U>
+  struct rebind
+  {
+    /// Type of the rebound allocator.
+    using other = huge_page_allocator<U, HugePageThreshold>;
+  };
+
+  /// Default constructor.
+  huge_page_allocator() = default;
+
+  /// Converting constructor from an allocator for another value type.
+  template<class U>
+  huge_page_allocator(const huge_page_allocator<U, HugePageThreshold>&) noexcept {}
+
+  /// Allocates uninitialized storage for `n` elements.
+  /**
+   * @param n Number of elements.
+   * @return Pointer to the allocated storage.
+   */
+  [[nodiscard]] T* allocate(size_t n)
+  {
+    if (n > size_t(-1) / sizeof(T))
+    {
+      throw std::bad_array_new_length();
+    }
+    auto bytes = n * sizeof(T);
+    if (bytes < HugePageThreshold)
+    {
+      return std::allocator<T>().allocate(n);
+    }
+    auto alignedBytes = round_to_huge_pages(bytes);
+    auto result = std::aligned_alloc(huge_page_size, alignedBytes);
+    if (result == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+#if defined(MADV_HUGEPAGE)
+    // The advice is only a hint, a failure doesn't affect correctness.
+    madvise(result, alignedBytes, MADV_HUGEPAGE);
+#endif
+    return static_cast<T*>(result);
+  }
+
+  /// Deallocates storage obtained by `allocate`.
+  /**
+   * @param p Pointer returned by `allocate`.
+   * @param n Number of elements passed to `allocate`.
+   */
+  void deallocate(T* p, size_t n) noexcept
+  {
+    if (n * sizeof(T) < HugePageThreshold)
+    {
+      std::allocator<T>().deallocate(p, n);
+    }
+    else
+    {
+      std::free(p);
+    }
+  }
+
+  /// Default-initializes an element (i.e. arithmetic values are left uninitialized).
+  /**
+   * @tparam U Deduced element type.
+   * @param p Address of the element.
+   */
+  template<class U>
+  void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>)
+  {
+    ::new(static_cast<void*>(p)) U;
+  }
+
+  /// Constructs an element from the given arguments.
+  /**
+   * @tparam U Deduced element type.
+   * @tparam Args Deduced types of the constructor arguments.
+   * @param p Address of the element.
+   * @param args Constructor arguments.
+   */
+  template<class U, class... Args>
+  void construct(U* p, Args&&... args)
+  {
+    std::construct_at(p, std::forward<Args>(args)...);
+  }
+
+  /// All instances are interchangeable.
+  template<class U>
+  bool operator==(const huge_page_allocator<U, HugePageThreshold>&) const noexcept
+  {
+    return true;
+  }
+
+private:
+  /// Rounds a size in bytes up to a multiple of `huge_page_size` (as required by `std::aligned_alloc`).
+  static size_t round_to_huge_pages(size_t bytes)
+  {
+    return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+  }
+};
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_ALLOCATOR
@@ -0,0 +1,82 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Conditional execution of simd code paths, which skips the unneeded path for uniform masks.
+ */
+
+#ifndef SIMD_ACCESS_BRANCH
+#define SIMD_ACCESS_BRANCH
+
+#include <experimental/bits/simd.h>
+#include <type_traits>
+
+#include "simd_access/base.hpp"
+#include "simd_access/load_store.hpp"
+#include "simd_access/reflection.hpp"
+
+namespace simd_access
+{
+
+/**
+ * Returns `then_fn()` for the lanes set in `mask` and `else_fn()` for the other lanes. Unlike `where`, which needs
+ * the results of both paths, only one path is executed, if the mask is uniform (`all_of` or `none_of`). Both paths
+ * are executed and blended only for mixed masks, thus the paths must not have side effects on memory.
+ * Overloaded for scalar masks, where it becomes a plain `if`, so that the same loop body compiles for simd and
+ * scalar indices.
+ * ~~~{.cpp}
+ * auto flux = sa::branch(pressureJump > limit,
+ *   [&]() { return shock_flux(left, right); },
+ *   [&]() { return smooth_flux(left, right); });
+ * ~~~
+ * @tparam M Deduced type of the simd mask.
+ * @param mask The simd mask.
+ * @param then_fn Functor returning the result (a `stdx::simd` or a structure-of-simd) for the set lanes.
+ * @param else_fn Functor returning the result for the unset lanes. Its result must be convertible to the result of
+ *   `then_fn`.
+ * @return The blended result.
+ */
+template<class M>
+  requires(!std::is_same_v<M, bool>)
+inline auto branch(const M& mask, auto&& then_fn, auto&& else_fn)
+{
+  using ResultType = std::remove_cvref_t<decltype(then_fn())>;
+  if (stdx::all_of(mask))
+  {
+    return ResultType(then_fn());
+  }
+  if (stdx::none_of(mask))
+  {
+    return ResultType(else_fn());
+  }
+  ResultType result(else_fn());
+  ResultType thenResult(then_fn());
+  simd_members([&](auto& dest, const auto& src)
+    {
+      using SimdType = std::remove_cvref_t<decltype(dest)>;
+      stdx::where(simd_mask_for<typename SimdType::value_type, SimdType::size()>(mask), dest) = src;
+    }, result, thenResult);
+  return result;
+}
+
+/**
+ * Returns `then_fn()`, if `mask` is true, otherwise `else_fn()`. Overloaded for simd masks.
+ * @param mask The condition.
+ * @param then_fn Functor returning the result, if `mask` is true.
+ * @param else_fn Functor returning the result, if `mask` is false. Its result must be convertible to the result of
+ *   `then_fn`.
+ * @return The result of the executed functor.
+ */
+inline auto branch(bool mask, auto&& then_fn, auto&& else_fn)
+{
+  using ResultType = std::remove_cvref_t<decltype(then_fn())>;
+  if (mask)
+  {
+    return ResultType(then_fn());
+  }
+  return ResultType(else_fn());
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_BRANCH
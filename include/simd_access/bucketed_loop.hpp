@@ -0,0 +1,137 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Vectorized iteration over heterogeneous elements, which are bucketed by a type key.
+ *
+ * Polymorphic elements (e.g. boundary faces of different boundary condition types) can't be simdized as a whole,
+ * since every element needs different code. \ref type_buckets sorts an index range by a type key once, and
+ * \ref bucketed_loop runs a type-specialized loop body for every bucket. The buckets can be reused, as long as the
+ * types of the elements don't change.
+ * ~~~{.cpp}
+ * sa::type_buckets<3> buckets(0, faces.size(), [&](auto i) { return faces[i].kind(); });
+ * for (int step = 0; step < steps; ++step)
+ * {
+ *   sa::bucketed_loop<vec_size>(buckets, [&](auto kind, auto i)
+ *     {
+ *       SIMD_ACCESS(flux, i) = boundary_flux<decltype(kind)::value>(SIMD_ACCESS_V(state, i));
+ *     });
+ * }
+ * ~~~
+ */
+
+#ifndef SIMD_ACCESS_BUCKETED_LOOP
+#define SIMD_ACCESS_BUCKETED_LOOP
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "simd_access/simd_loop.hpp"
+
+namespace simd_access
+{
+
+/// Permutation of an index range, which groups the indices by a type key.
+/**
+ * The indices of every bucket keep their original order, so that contiguous runs of elements of the same type stay
+ * contiguous.
+ * @tparam Buckets Number of buckets. The keys are in `[0, Buckets)`.
+ * @tparam IndexType Type of the indices.
+ */
+template<int Buckets, std::integral IndexType = int>
+  requires (Buckets > 0)
+class type_buckets
+{
+public:
+  /// Constructor. Sorts the indices of a range into the buckets of their keys.
+  /**
+   * @param start Inclusive start of the range of indices.
+   * @param end Exclusive end of the range of indices.
+   * @param key Function returning the key of an index, which is an integral value in `[0, Buckets)`.
+   */
+  type_buckets(IndexType start, IndexType end, auto&& key)
+  {
+    offsets_.fill(0);
+    std::vector<int> keys;
+    keys.reserve(start < end ? end - start : 0);
+    for (IndexType i = start; i < end; ++i)
+    {
+      keys.push_back(int(key(i)));
+      assert(keys.back() >= 0 && keys.back() < Buckets);
+      ++offsets_[keys.back() + 1];
+    }
+    for (int k = 0; k < Buckets; ++k)
+    {
+      offsets_[k + 1] += offsets_[k];
+    }
+    indices_.resize(keys.size());
+    auto fill = offsets_;
+    for (IndexType i = start; i < end; ++i)
+    {
+      indices_[fill[keys[i - start]]++] = i;
+    }
+  }
+
+  /// Returns the number of indices in a bucket.
+  /**
+   * @param bucket Key of the bucket.
+   * @return Number of indices.
+   */
+  size_t size(int bucket) const { return offsets_[bucket + 1] - offsets_[bucket]; }
+
+  /// Returns the begin iterator of the indices of a bucket.
+  /**
+   * @param bucket Key of the bucket.
+   * @return Iterator.
+   */
+  auto begin(int bucket) const { return indices_.begin() + offsets_[bucket]; }
+
+  /// Returns the end iterator of the indices of a bucket.
+  /**
+   * @param bucket Key of the bucket.
+   * @return Iterator.
+   */
+  auto end(int bucket) const { return indices_.begin() + offsets_[bucket + 1]; }
+
+  /// Returns the indices of all buckets, ordered by bucket.
+  const std::vector<IndexType>& indices() const { return indices_; }
+
+private:
+  /// Indices sorted by bucket.
+  std::vector<IndexType> indices_;
+  /// Start offsets of the buckets in `indices_`, followed by the total size.
+  std::array<size_t, Buckets + 1> offsets_;
+};
+
+/**
+ * Simd-ized iteration over the buckets of a \ref type_buckets permutation. Every bucket is traversed by a
+ * \ref classifying_loop, so that runs of contiguous indices of a bucket are accessed contiguously and the other
+ * indices are gathered and scattered.
+ * @tparam SimdSize Vector size.
+ * @tparam Buckets Deduced number of buckets.
+ * @tparam IndexType Deduced type of the indices.
+ * @param buckets The bucketed indices.
+ * @param fn Generic function to be called with two arguments. The first one is the key of the bucket as
+ *   `std::integral_constant<int, Key>`, so that the function can be specialized per type. The second one is the
+ *   index as passed by \ref classifying_loop.
+ */
+template<int SimdSize, int Buckets, class IndexType>
+inline void bucketed_loop(const type_buckets<Buckets, IndexType>& buckets, auto&& fn)
+{
+  [&]<int... Key>(std::integer_sequence<int, Key...>)
+  {
+    (classifying_loop<SimdSize>(buckets.begin(Key), buckets.end(Key), [&](const auto& i)
+      {
+        fn(std::integral_constant<int, Key>(), i);
+      }), ...);
+  } (std::make_integer_sequence<int, Buckets>());
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_BUCKETED_LOOP
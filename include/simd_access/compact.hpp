@@ -0,0 +1,137 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Stream compaction of an index range to the dense list of the indices, which fulfill a predicate.
+ *
+ * Sublists like "cells with negative pressure" are built by \ref compact, whose predicate is a linear \ref loop body.
+ * The resulting list is traversed by the indirect \ref loop overload:
+ * ~~~{.cpp}
+ * std::vector<int> negative(cells.size());
+ * negative.resize(sa::compact<vec_size>(0, cells.size(),
+ *   [&](auto i) { return SIMD_ACCESS_V(pressure, i) < 0.0; }, negative.data()) - negative.data());
+ * sa::loop<vec_size>(negative.begin(), negative.end(), [&](auto i) { ... });
+ * ~~~
+ */
+
+#ifndef SIMD_ACCESS_COMPACT
+#define SIMD_ACCESS_COMPACT
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <experimental/bits/simd.h>
+#include <functional>
+#include <type_traits>
+
+#include "simd_access/index.hpp"
+#include "simd_access/simd_loop.hpp"
+
+namespace simd_access
+{
+
+///@cond
+// Positions of the set bits of every byte value, padded with zeros.
+inline constexpr auto compact_positions = []()
+  {
+    std::array<std::array<std::uint8_t, 8>, 256> result{};
+    for (int bits = 0; bits < 256; ++bits)
+    {
+      int count = 0;
+      for (int lane = 0; lane < 8; ++lane)
+      {
+        if (bits & (1 << lane))
+        {
+          result[bits][count++] = std::uint8_t(lane);
+        }
+      }
+    }
+    return result;
+  }();
+
+// Bits of a simd mask, bit l is set, if lane l is set. The mask is converted to lanes of the smallest unsigned type
+// with a bit per lane, which select their bit values. Thus the bits are combined by a vector reduction instead of a
+// branch or a shift per lane.
+template<class MaskType>
+inline std::uint64_t mask_bits(const MaskType& mask)
+{
+  constexpr int size = MaskType::size();
+  using BitType = std::conditional_t<size <= 8, std::uint8_t, std::conditional_t<size <= 16, std::uint16_t,
+    std::conditional_t<size <= 32, std::uint32_t, std::uint64_t>>>;
+  using BitsType = stdx::fixed_size_simd<BitType, size>;
+  BitsType bits(0);
+  stdx::where(typename BitsType::mask_type(stdx::to_fixed_size(mask)), bits) =
+    BitsType([](auto lane) { return BitType(BitType(1) << lane); });
+  return stdx::reduce(bits, std::bit_or<>());
+}
+
+// Writes base + lane for every set bit to out. The positions are looked up per byte of the mask bits and stored as
+// a whole chunk, so that the compaction is free of branches. Up to 8 indices after the returned end are overwritten.
+template<int SimdSize, class IndexType>
+inline IndexType* compact_lanes(std::uint64_t bits, IndexType base, IndexType* out)
+{
+  constexpr int chunkSize = SimdSize < 8 ? SimdSize : 8;
+  for (int chunk = 0; chunk < SimdSize; chunk += chunkSize)
+  {
+    auto chunkBits = (bits >> chunk) & 0xff;
+    const auto& positions = compact_positions[chunkBits];
+    stdx::fixed_size_simd<IndexType, chunkSize> lanes([&](auto lane) { return IndexType(positions[lane]); });
+    (lanes + IndexType(base + chunk)).copy_to(out, stdx::element_aligned);
+    out += std::popcount(chunkBits);
+  }
+  return out;
+}
+///@endcond
+
+/**
+ * Writes the indices of a range, which fulfill a predicate, densely and in ascending order to `out`. The predicate is
+ * called like the body of a linear \ref loop, thus for a simd index it returns a `stdx::simd_mask` of `SimdSize`
+ * lanes. The set lanes are compacted with a lookup table of the bit positions of every mask byte instead of a branch
+ * per lane.
+ *
+ * For parallel execution the range is split into chunks. Every thread compacts its chunk into the part of `out`,
+ * which corresponds to the chunk, i.e. at `out + (chunkStart - start)`. Afterwards the results of the chunks are
+ * moved together at the exclusive prefix sums of their counts:
+ * ~~~{.cpp}
+ * // in thread t
+ * counts[t] = sa::compact<vec_size>(chunkStart[t], chunkStart[t + 1], predicate, out + chunkStart[t]) -
+ *   (out + chunkStart[t]);
+ * // after joining the threads
+ * auto last = out + counts[0];
+ * for (int t = 1; t < threads; ++t)
+ * {
+ *   last = std::copy_n(out + chunkStart[t], counts[t], last);
+ * }
+ * ~~~
+ * @tparam SimdSize Vector size.
+ * @tparam IndexType Deduced type of the written indices.
+ * @param start Start of the iteration range [start, end).
+ * @param end End of the iteration range [start, end).
+ * @param predicate Generic function taking either `index<SimdSize, IntegralType>` or `IntegralType` and returning a
+ *   simd mask or a `bool`, respectively.
+ * @param out Destination of the indices. It must have room for `end - start` indices, since the entries after the
+ *   returned end may be overwritten.
+ * @return Pointer past the last written index.
+ */
+template<int SimdSize, std::integral IndexType>
+  requires (SimdSize <= 64 && (SimdSize <= 8 || SimdSize % 8 == 0))
+inline IndexType* compact(std::integral auto start, std::integral auto end, auto&& predicate, IndexType* out)
+{
+  loop<SimdSize>(start, end, [&](auto i)
+    {
+      if constexpr (simd_index<decltype(i)>)
+      {
+        out = compact_lanes<SimdSize>(mask_bits(predicate(i)), IndexType(i.index_), out);
+      }
+      else if (predicate(i))
+      {
+        *out++ = IndexType(i);
+      }
+    });
+  return out;
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_COMPACT
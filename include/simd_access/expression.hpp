@@ -0,0 +1,598 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Expression templates for simd accesses.
+ *
+ * The arithmetic operators of \ref value_access load their operands immediately. `expr(SIMD_ACCESS(a, i))` instead
+ * returns an expression leaf. Arithmetic operators on leaves build an expression tree, which is evaluated as a whole
+ * when it is assigned:
+ * - Each distinct memory location of the statement is loaded once, even if it appears several times.
+ * - Products added to or subtracted from another operand (`a * b + c`, `c - a * b`, ...) and explicit
+ *   \ref simd_access::fma calls are evaluated with fused multiply-add.
+ * - Compound assignments to a leaf load and store the location exactly once.
+ * ~~~{.cpp}
+ * using simd_access::expr;
+ * expr(SIMD_ACCESS(y, i)) += expr(SIMD_ACCESS(a, i)) * expr(SIMD_ACCESS(x, i));  // one fma, loads y once
+ * ~~~
+ * For scalar indices `expr` returns a \ref scalar_expression, so the same loop body serves the scalar residual loop and
+ * its statements are contracted in the same way.
+ */
+
+#ifndef SIMD_ACCESS_EXPRESSION
+#define SIMD_ACCESS_EXPRESSION
+
+#include <cmath>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "simd_access/simd_access.hpp"
+
+namespace simd_access
+{
+
+///@cond
+template<class T>
+struct is_expression_node : std::false_type {};
+///@endcond
+
+/// Types of the nodes of an expression tree.
+template<class T>
+concept expression_node = is_expression_node<std::remove_cvref_t<T>>::value;
+
+///@cond
+template<class T>
+constexpr size_t leaf_count = 0;
+
+template<expression_node T>
+constexpr size_t leaf_count<T> = T::leaf_count;
+
+template<class T>
+concept value_access_type =
+  requires(std::remove_cvref_t<T> x)
+    { []<class Location, size_t ElementSize>(value_access<Location, ElementSize>&){}(x); };
+///@endcond
+
+/// Expression leaf representing a simd access to a memory location.
+/**
+ * @tparam Location Type of the location of the simd data.
+ * @tparam ElementSize Size of the array elements, which (or one of its members) are accessed by the simd index.
+ */
+template<class Location, size_t ElementSize>
+class access_expression
+{
+public:
+  /// Number of leaves of this expression.
+  static constexpr size_t leaf_count = 1;
+
+  /// Constructor.
+  /**
+   * @param location The location specification of the accessed simd variable.
+   */
+  explicit access_expression(const Location& location) :
+    location_(location)
+  {}
+
+  /// Returns the location specification of the accessed simd variable.
+  const Location& location() const { return location_; }
+
+  /// Loads the simd value.
+  /**
+   * @return The simd value.
+   */
+  auto load() const
+  {
+    return simd_access::load<ElementSize>(location_);
+  }
+
+  /// Checks, whether another leaf accesses the same memory location.
+  /**
+   * @param other Another expression leaf.
+   * @return True, if both leaves access the same elements.
+   */
+  template<class OtherLocation, size_t OtherElementSize>
+  bool same_location(const access_expression<OtherLocation, OtherElementSize>& other) const
+  {
+    if constexpr (std::is_same_v<Location, OtherLocation> && ElementSize == OtherElementSize)
+    {
+      if constexpr (requires { location_.indices_; })
+      {
+        return location_.base_ == other.location_.base_ && &location_.indices_ == &other.location_.indices_;
+      }
+      else if constexpr (requires { location_.stride_; })
+      {
+        return location_.base_ == other.location_.base_ && location_.stride_ == other.location_.stride_;
+      }
+      else
+      {
+        return location_.base_ == other.location_.base_;
+      }
+    }
+    return false;
+  }
+
+  /// Leaves of other kinds never access the same location.
+  /**
+   * @return False.
+   */
+  bool same_location(const auto&) const { return false; }
+
+  /// Assignment operator. Evaluates `source` and stores the result.
+  /**
+   * @param source An expression or a simd value.
+   */
+  void operator=(const auto& source)
+  {
+    store<ElementSize>(location_, evaluate(source));
+  }
+
+  /// Copy constructor. Copies the location, not the accessed data.
+  access_expression(const access_expression&) = default;
+
+  /// Assignment of another leaf. Loads the accessed data of `source` and stores it, like the other assignments.
+  /**
+   * @param source Another leaf of the same type.
+   * @return `*this`.
+   */
+  access_expression& operator=(const access_expression& source)
+  {
+    store<ElementSize>(location_, evaluate(source));
+    return *this;
+  }
+
+  /// Compound assignment operators. The location is loaded and stored once.
+  /**
+   * @param source An expression or a simd value.
+   */
+  void operator+=(const auto& source) { *this = *this + source; }
+  /// \copydoc operator+=
+  void operator-=(const auto& source) { *this = *this - source; }
+  /// \copydoc operator+=
+  void operator*=(const auto& source) { *this = *this * source; }
+  /// \copydoc operator+=
+  void operator/=(const auto& source) { *this = *this / source; }
+
+private:
+  template<class OtherLocation, size_t OtherElementSize>
+  friend class access_expression;
+
+  /// The location specification of the accessed simd variable.
+  Location location_;
+};
+
+/// Expression leaf representing an arithmetic scalar, e.g. an access with a scalar index in the residual loop.
+/**
+ * Scalar leaves are evaluated like simd leaves, hence statements are contracted in the same way for every element.
+ * @tparam T Type of the scalar. An lvalue reference for accesses to memory, a value type for temporaries.
+ */
+template<class T>
+class scalar_expression
+{
+public:
+  /// Number of leaves of this expression.
+  static constexpr size_t leaf_count = 1;
+
+  /// Constructor.
+  /**
+   * @param value The scalar or a reference to it.
+   */
+  explicit scalar_expression(T value) :
+    value_(value)
+  {}
+
+  /// Returns the value of the scalar.
+  /**
+   * @return The value.
+   */
+  std::remove_cvref_t<T> load() const
+  {
+    return value_;
+  }
+
+  /// Checks, whether another leaf refers to the same scalar.
+  /**
+   * @param other Another expression leaf.
+   * @return True, if both leaves reference the same memory location.
+   */
+  bool same_location(const auto& other) const
+  {
+    using OtherType = std::remove_cvref_t<decltype(other)>;
+    if constexpr (std::is_lvalue_reference_v<T> && std::is_same_v<OtherType, scalar_expression>)
+    {
+      return &value_ == &other.value_;
+    }
+    return false;
+  }
+
+  /// Assignment operator. Evaluates `source` and stores the result.
+  /**
+   * @param source An expression or a scalar value.
+   */
+  void operator=(const auto& source)
+    requires (std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>)
+  {
+    value_ = evaluate(source);
+  }
+
+  /// Copy constructor. Copies the reference, not the referenced scalar.
+  scalar_expression(const scalar_expression&) = default;
+
+  /// Assignment of another leaf. Stores the value of `source`, like the other assignments.
+  /**
+   * @param source Another leaf of the same type.
+   * @return `*this`.
+   */
+  scalar_expression& operator=(const scalar_expression& source)
+    requires (std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>)
+  {
+    value_ = evaluate(source);
+    return *this;
+  }
+
+  /// Compound assignment operators. The scalar is loaded and stored once.
+  /**
+   * @param source An expression or a scalar value.
+   */
+  void operator+=(const auto& source) { *this = *this + source; }
+  /// \copydoc operator+=
+  void operator-=(const auto& source) { *this = *this - source; }
+  /// \copydoc operator+=
+  void operator*=(const auto& source) { *this = *this * source; }
+  /// \copydoc operator+=
+  void operator/=(const auto& source) { *this = *this / source; }
+
+private:
+  /// The scalar or a reference to it.
+  T value_;
+};
+
+/// Expression node of a binary operation.
+/**
+ * @tparam Op Function object type of the operation (e.g. `std::plus<>`).
+ * @tparam L Type of the left operand.
+ * @tparam R Type of the right operand.
+ */
+template<class Op, class L, class R>
+struct binary_expression
+{
+  /// Function object type of the operation.
+  using operation = Op;
+  /// Number of leaves of this expression.
+  static constexpr size_t leaf_count = simd_access::leaf_count<L> + simd_access::leaf_count<R>;
+  /// Left operand.
+  L left_;
+  /// Right operand.
+  R right_;
+};
+
+/// Expression node of a negation.
+/**
+ * @tparam A Type of the operand.
+ */
+template<class A>
+struct negate_expression
+{
+  /// Number of leaves of this expression.
+  static constexpr size_t leaf_count = simd_access::leaf_count<A>;
+  /// Operand.
+  A operand_;
+};
+
+/// Expression node of a fused multiply-add `a * b + c`.
+/**
+ * @tparam A Type of the first factor.
+ * @tparam B Type of the second factor.
+ * @tparam C Type of the summand.
+ */
+template<class A, class B, class C>
+struct fma_expression
+{
+  /// Number of leaves of this expression.
+  static constexpr size_t leaf_count =
+    simd_access::leaf_count<A> + simd_access::leaf_count<B> + simd_access::leaf_count<C>;
+  /// First factor.
+  A a_;
+  /// Second factor.
+  B b_;
+  /// Summand.
+  C c_;
+};
+
+///@cond
+template<class Location, size_t ElementSize>
+struct is_expression_node<access_expression<Location, ElementSize>> : std::true_type {};
+
+template<class T>
+struct is_expression_node<scalar_expression<T>> : std::true_type {};
+
+template<class Op, class L, class R>
+struct is_expression_node<binary_expression<Op, L, R>> : std::true_type {};
+
+template<class A>
+struct is_expression_node<negate_expression<A>> : std::true_type {};
+
+template<class A, class B, class C>
+struct is_expression_node<fma_expression<A, B, C>> : std::true_type {};
+
+template<class T>
+inline auto as_operand(const T& value)
+{
+  return value;
+}
+
+template<class Location, size_t ElementSize>
+inline auto as_operand(const value_access<Location, ElementSize>& access)
+{
+  return access_expression<Location, ElementSize>(access.location());
+}
+
+template<class T>
+using operand_t = decltype(as_operand(std::declval<const T&>()));
+
+template<class L, class R>
+concept expression_operands = expression_node<L> || expression_node<R>;
+
+template<class Op, class L, class R>
+inline auto make_binary_expression(const L& left, const R& right)
+{
+  return binary_expression<Op, operand_t<L>, operand_t<R>>{ as_operand(left), as_operand(right) };
+}
+
+template<class T>
+constexpr bool is_product = false;
+
+template<class L, class R>
+constexpr bool is_product<binary_expression<std::multiplies<>, L, R>> = true;
+
+// Fused multiply-add of evaluated operands. Scalar operands are broadcasted.
+inline auto fused_multiply_add(const auto& a, const auto& b, const auto& c)
+{
+  using ResultType = decltype(a * b + c);
+  if constexpr (stdx_simd<ResultType>)
+  {
+    return stdx::fma(ResultType(a), ResultType(b), ResultType(c));
+  }
+  else if constexpr (std::is_floating_point_v<ResultType>)
+  {
+    return std::fma(ResultType(a), ResultType(b), ResultType(c));
+  }
+  else
+  {
+    return a * b + c;
+  }
+}
+
+// Collects references to the leaves in depth-first order.
+inline auto collect_leaves(const auto& node)
+{
+  using T = std::remove_cvref_t<decltype(node)>;
+  if constexpr (requires { node.load(); })
+  {
+    return std::tuple<const T&>(node);
+  }
+  else if constexpr (requires { node.left_; })
+  {
+    return std::tuple_cat(collect_leaves(node.left_), collect_leaves(node.right_));
+  }
+  else if constexpr (requires { node.operand_; })
+  {
+    return collect_leaves(node.operand_);
+  }
+  else if constexpr (requires { node.a_; })
+  {
+    return std::tuple_cat(collect_leaves(node.a_), collect_leaves(node.b_), collect_leaves(node.c_));
+  }
+  else
+  {
+    return std::tuple<>();
+  }
+}
+
+// Loads all leaves. A leaf, which accesses the same location as a preceding leaf, reuses its value.
+template<class... Leaves>
+inline auto load_leaves(const std::tuple<Leaves...>& leaves)
+{
+  using ValueTypes = std::tuple<decltype(std::declval<Leaves>().load())...>;
+  ValueTypes values;
+  auto reuse_value = [&]<size_t J, size_t K>(std::integral_constant<size_t, J>, std::integral_constant<size_t, K>)
+    {
+      if constexpr (std::is_same_v<std::tuple_element_t<J, ValueTypes>, std::tuple_element_t<K, ValueTypes>>)
+      {
+        if (std::get<J>(leaves).same_location(std::get<K>(leaves)))
+        {
+          std::get<K>(values) = std::get<J>(values);
+          return true;
+        }
+      }
+      return false;
+    };
+  auto load_leaf = [&]<size_t K>(std::integral_constant<size_t, K>)
+    {
+      bool loaded = [&]<size_t... J>(std::index_sequence<J...>)
+        {
+          return (reuse_value(std::integral_constant<size_t, J>(), std::integral_constant<size_t, K>()) || ...);
+        }(std::make_index_sequence<K>());
+      if (!loaded)
+      {
+        std::get<K>(values) = std::get<K>(leaves).load();
+      }
+    };
+  [&]<size_t... K>(std::index_sequence<K...>)
+    {
+      (load_leaf(std::integral_constant<size_t, K>()), ...);
+    }(std::index_sequence_for<Leaves...>());
+  return values;
+}
+
+// Evaluates a node with the loaded values. Offset is the index of the first leaf of the node.
+template<size_t Offset>
+inline auto evaluate_node(const auto& node, const auto& values)
+{
+  using T = std::remove_cvref_t<decltype(node)>;
+  if constexpr (requires { node.load(); })
+  {
+    return std::get<Offset>(values);
+  }
+  else if constexpr (requires { node.left_; })
+  {
+    using L = decltype(node.left_);
+    using R = decltype(node.right_);
+    constexpr auto rightOffset = Offset + leaf_count<L>;
+    auto left = [&] { return evaluate_node<Offset>(node.left_, values); };
+    auto right = [&] { return evaluate_node<rightOffset>(node.right_, values); };
+    constexpr bool isSum = std::is_same_v<T, binary_expression<std::plus<>, L, R>>;
+    constexpr bool isDifference = std::is_same_v<T, binary_expression<std::minus<>, L, R>>;
+    if constexpr ((isSum || isDifference) && is_product<L>)
+    {
+      auto a = evaluate_node<Offset>(node.left_.left_, values);
+      auto b = evaluate_node<Offset + leaf_count<decltype(node.left_.left_)>>(node.left_.right_, values);
+      if constexpr (isSum)
+      {
+        return fused_multiply_add(a, b, right());
+      }
+      else
+      {
+        return fused_multiply_add(a, b, -right());
+      }
+    }
+    else if constexpr ((isSum || isDifference) && is_product<R>)
+    {
+      auto a = evaluate_node<rightOffset>(node.right_.left_, values);
+      auto b = evaluate_node<rightOffset + leaf_count<decltype(node.right_.left_)>>(node.right_.right_, values);
+      if constexpr (isSum)
+      {
+        return fused_multiply_add(a, b, left());
+      }
+      else
+      {
+        return fused_multiply_add(-a, b, left());
+      }
+    }
+    else
+    {
+      return typename T::operation()(left(), right());
+    }
+  }
+  else if constexpr (requires { node.operand_; })
+  {
+    return -evaluate_node<Offset>(node.operand_, values);
+  }
+  else if constexpr (requires { node.a_; })
+  {
+    constexpr auto offsetB = Offset + leaf_count<decltype(node.a_)>;
+    constexpr auto offsetC = offsetB + leaf_count<decltype(node.b_)>;
+    return fused_multiply_add(evaluate_node<Offset>(node.a_, values), evaluate_node<offsetB>(node.b_, values),
+      evaluate_node<offsetC>(node.c_, values));
+  }
+  else
+  {
+    return node;
+  }
+}
+///@endcond
+
+/**
+ * Evaluates an expression. Every distinct location is loaded once.
+ * @param e Expression.
+ * @return The value of the expression (usually a simd value).
+ */
+template<expression_node T>
+inline auto evaluate(const T& e)
+{
+  return evaluate_node<0>(e, load_leaves(collect_leaves(e)));
+}
+
+/**
+ * Creates an expression leaf for a simd access.
+ * @tparam Location Deduced type of the location of the simd data.
+ * @tparam ElementSize Deduced size of the array elements.
+ * @param access A simd access as returned by `SIMD_ACCESS`.
+ * @return An \ref access_expression.
+ */
+template<class Location, size_t ElementSize>
+inline auto expr(value_access<Location, ElementSize>&& access)
+{
+  return access_expression<Location, ElementSize>(access.location());
+}
+
+/**
+ * Overload of `expr` for scalar indices, i.e. for arithmetic values or references returned by `SIMD_ACCESS`.
+ * @tparam T Deduced type of the scalar.
+ * @param value Arithmetic value or reference.
+ * @return A \ref scalar_expression. It references `value`, if `value` is an lvalue.
+ */
+template<class T>
+  requires std::is_arithmetic_v<std::remove_cvref_t<T>>
+inline auto expr(T&& value)
+{
+  return scalar_expression<std::conditional_t<std::is_lvalue_reference_v<T>, T, std::remove_cvref_t<T>>>(
+    std::forward<T>(value));
+}
+
+/**
+ * Overload of `expr` for other values, e.g. structures accessed by a scalar index.
+ * @param value Any value.
+ * @return `value`.
+ */
+template<class T>
+  requires (!value_access_type<T> && !std::is_arithmetic_v<std::remove_cvref_t<T>>)
+inline T&& expr(T&& value)
+{
+  return std::forward<T>(value);
+}
+
+/**
+ * Fused multiply-add `a * b + c`. If an operand is an expression, an expression is returned. Otherwise the result is
+ * computed immediately with `stdx::fma` or `std::fma`.
+ * @param a First factor.
+ * @param b Second factor.
+ * @param c Summand.
+ * @return An expression or the value of `a * b + c`.
+ */
+template<class A, class B, class C>
+inline auto fma(const A& a, const B& b, const C& c)
+{
+  if constexpr (expression_node<A> || expression_node<B> || expression_node<C>)
+  {
+    return fma_expression<operand_t<A>, operand_t<B>, operand_t<C>>{ as_operand(a), as_operand(b), as_operand(c) };
+  }
+  else
+  {
+    return fused_multiply_add(to_simd(a), to_simd(b), to_simd(c));
+  }
+}
+
+/// Creates a binary operator for expressions.
+/**
+ * @param op Token for a binary operator (e.g. +,-,*,/).
+ * @param fn Function object type of the operator.
+ */
+#define EXPRESSION_BIN_OP( op, fn ) \
+  template<class L, class R> \
+    requires expression_operands<L, R> \
+  inline auto operator op(const L& left, const R& right) \
+  { \
+    return make_binary_expression<fn>(left, right); \
+  }
+
+EXPRESSION_BIN_OP(+, std::plus<>)
+EXPRESSION_BIN_OP(-, std::minus<>)
+EXPRESSION_BIN_OP(*, std::multiplies<>)
+EXPRESSION_BIN_OP(/, std::divides<>)
+
+/**
+ * Negation of an expression.
+ * @param operand Expression.
+ * @return An expression.
+ */
+template<expression_node A>
+inline auto operator-(const A& operand)
+{
+  return negate_expression<A>{ operand };
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_EXPRESSION
@@ -0,0 +1,145 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief A small software cache for repeated gathers of the same elements.
+ */
+
+#ifndef SIMD_ACCESS_GATHER_CACHE
+#define SIMD_ACCESS_GATHER_CACHE
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "simd_access/simd_access.hpp"
+
+namespace simd_access
+{
+
+/// A direct-mapped cache in front of the indexed gathers of one array (or one member of the array elements).
+/**
+ * In edge or face loops each node is referenced several times, often by neighboring index vectors. The cache keeps
+ * the most recently gathered elements, keyed by their index, so that repeated gathers of a node are served from a
+ * small table, which stays in L1. Create one cache per accessed location and loop:
+ * ~~~{.cpp}
+ * sa::gather_cache<NodeState> cache;
+ * sa::loop<vec_size>(size_t(0), edgeCount, [&](auto i)
+ *   {
+ *     auto a = cache.load(SIMD_ACCESS(state, SIMD_ACCESS_V(first, i)));
+ *     ...
+ *   });
+ * ~~~
+ * The cache is opt-in: every lane costs a tag compare, a branch and, on a miss, a copy into the slot, which may cost
+ * more than the hardware gather it saves. Measured edge loops:
+ * - `double` node values on a 2048x2048 grid (`Renumbering_CachedEdgeGather`): 8.8 GB/s plain vs 4.85 GB/s cached
+ *   with RCM numbering (hit rate 0.50), 1.15 GB/s vs 0.62 GB/s with random numbering (hit rate 0.30).
+ * - 64-byte node states, each referenced by four edges of nearby index vectors: 38.9 us plain vs 90.5 us cached for
+ *   4096 nodes, 38.9 ms vs 89.2 ms for 1M nodes (hit rate 0.74).
+ *
+ * Hence gathers, which the hardware caches serve, are faster without it. Candidates are elements, which are expensive
+ * to load, with a high hit rate. Use the counters (see \ref hit_rate) to decide per kernel, whether the cache pays off.
+ * The cache doesn't observe writes. Call \ref clear, if the cached array is modified during the loop. A load from
+ * another location invalidates all entries, hence alternating locations don't return stale values, but never hit.
+ * @tparam T Type of the cached elements. Must be copyable.
+ * @tparam Slots Number of cache entries. Must be a power of two.
+ */
+template<class T, size_t Slots = 256>
+class gather_cache
+{
+  static_assert((Slots & (Slots - 1)) == 0, "the number of slots must be a power of two");
+
+public:
+  /// Gathers the elements of an indexed simd access through the cache.
+  /**
+   * @tparam Location Deduced type of the indexed location.
+   * @tparam ElementSize Deduced size of the array elements.
+   * @param access An indexed simd access as returned by `SIMD_ACCESS(base, index, ...)`.
+   * @return The simd value (a `stdx::simd` for arithmetic types, a structure-of-simd otherwise).
+   */
+  template<class Location, size_t ElementSize>
+    requires std::is_same_v<std::remove_const_t<typename Location::value_type>, T> &&
+      requires(Location location) { location.indices_; }
+  auto load(value_access<Location, ElementSize>&& access)
+  {
+    const auto& location = access.location();
+    if (base_ != location.base_)
+    {
+      // the slots are tagged by index only, so they are invalid for another location
+      slots_ = {};
+      base_ = location.base_;
+    }
+    auto lane = [&](int i) -> const T&
+      {
+        auto index = std::int64_t(location.indices_[i]);
+        auto& slot = slots_[size_t(index) & (Slots - 1)];
+        if (slot.index_ == index)
+        {
+          ++hits_;
+        }
+        else
+        {
+          ++misses_;
+          slot.index_ = index;
+          slot.value_ = location.template lane<ElementSize>(i);
+        }
+        return slot.value_;
+      };
+    constexpr auto simdSize = Location::size();
+    if constexpr (simd_arithmetic<T>)
+    {
+      return stdx::fixed_size_simd<T, simdSize>([&](int i) { return lane(i); });
+    }
+    else
+    {
+      return simdized_from_lanes<T, simdSize>([&](int i, auto&& assign) { assign(lane(i)); });
+    }
+  }
+
+  /// Overload for linear simd accesses and scalar indices (e.g. in the residual loop). Bypasses the cache.
+  /**
+   * @param access Any simd access or scalar value.
+   * @return `to_simd(access)`.
+   */
+  auto load(auto&& access)
+  {
+    return to_simd(access);
+  }
+
+  /// Invalidates all entries. The counters are kept.
+  void clear()
+  {
+    slots_ = {};
+    base_ = nullptr;
+  }
+
+  /// Number of lanes served from the cache.
+  size_t hits() const { return hits_; }
+  /// Number of lanes gathered from memory.
+  size_t misses() const { return misses_; }
+  /// Fraction of lanes served from the cache.
+  double hit_rate() const { return hits_ + misses_ > 0 ? double(hits_) / double(hits_ + misses_) : 0.0; }
+
+private:
+  /// A cache entry.
+  struct slot
+  {
+    /// Index of the cached element, -1 if empty.
+    std::int64_t index_ = -1;
+    /// The cached element.
+    T value_{};
+  };
+
+  /// The cache entries.
+  std::array<slot, Slots> slots_{};
+  /// Base address of the cached location.
+  const void* base_ = nullptr;
+  /// Number of cache hits.
+  size_t hits_ = 0;
+  /// Number of cache misses.
+  size_t misses_ = 0;
+};
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_GATHER_CACHE
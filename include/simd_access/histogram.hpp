@@ -0,0 +1,166 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Histograms and binned sums, whose scatter-adds are free of lane conflicts.
+ *
+ * A scatter-add `SIMD_ACCESS(bins, binIndex) += value` loses updates, if several lanes of the index vector hit the
+ * same bin, which is the common case for a small number of bins. \ref replicated_bins keeps a private copy of every
+ * bin per vector lane, so that the lanes of one vector never collide. The copies are summed up at the end.
+ * ~~~{.cpp}
+ * std::vector<int> counts(20);
+ * sa::histogram<vec_size>(0, cells.size(), [&](auto i) { return SIMD_ACCESS_V(mach, i) * 10.0; },
+ *   counts.data(), counts.size());
+ * ~~~
+ */
+
+#ifndef SIMD_ACCESS_HISTOGRAM
+#define SIMD_ACCESS_HISTOGRAM
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <experimental/bits/simd.h>
+#include <utility>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+
+namespace simd_access
+{
+
+/// Bins, which are replicated for every vector lane.
+/**
+ * The copy of bin `b` for lane `l` is stored at `b * SimdSize + l`, thus an index vector addresses `SimdSize`
+ * different elements, even if all lanes refer to the same bin. Besides, consecutive scalar updates of the same bin
+ * don't wait for each other, since they are distributed over the copies, too.
+ * Create one object per thread and add its sums to the shared bins after the loop.
+ * @tparam T Value type of the bins.
+ * @tparam SimdSize Vector size.
+ */
+template<class T, int SimdSize>
+class replicated_bins
+{
+public:
+  /// Constructor. Initializes all bins with zero.
+  /**
+   * @param bins Number of bins.
+   */
+  explicit replicated_bins(size_t bins) :
+    values_(bins * SimdSize, T(0)),
+    bins_(bins)
+  {}
+
+  /// Returns the number of bins.
+  size_t size() const { return bins_; }
+
+  /// Adds values to bins.
+  /**
+   * @param bin Bin index as simd with `SimdSize` lanes or as scalar. Must be in `[0, size())`. Floating point indices
+   *   are truncated.
+   * @param value Added value as simd with `SimdSize` lanes or as scalar.
+   */
+  void add(const auto& bin, const auto& value)
+  {
+    if constexpr (stdx_simd<std::remove_cvref_t<decltype(bin)>>)
+    {
+      using IndexType = stdx::fixed_size_simd<int, SimdSize>;
+      auto index = stdx::static_simd_cast<IndexType>(bin) * SimdSize + IndexType([](int lane) { return lane; });
+      assert(stdx::all_of(index >= 0 && index < int(values_.size())));
+      // The lanes address different elements, so the updates are independent of each other. Explicit scalar
+      // updates are faster than a generated gather and scatter.
+      for (int lane = 0; lane < SimdSize; ++lane)
+      {
+        if constexpr (stdx_simd<std::remove_cvref_t<decltype(value)>>)
+        {
+          values_[index[lane]] += value[lane];
+        }
+        else
+        {
+          values_[index[lane]] += value;
+        }
+      }
+    }
+    else
+    {
+      auto index = int(bin);
+      assert(index >= 0 && size_t(index) < bins_);
+      values_[size_t(index) * SimdSize + next_] += value;
+      next_ = (next_ + 1) % SimdSize;
+    }
+  }
+
+  /// Adds the sums of the bins to an array.
+  /**
+   * @param bins Array of at least \ref size() elements.
+   */
+  void add_to(T* bins) const
+  {
+    for (size_t b = 0; b < bins_; ++b)
+    {
+      bins[b] += stdx::reduce(stdx::fixed_size_simd<T, SimdSize>(values_.data() + b * SimdSize,
+        stdx::element_aligned));
+    }
+  }
+
+private:
+  /// Copies of the bins, the copies of one bin are stored consecutively.
+  std::vector<T> values_;
+  /// Number of bins.
+  size_t bins_;
+  /// Copy, which receives the next scalar update.
+  int next_ = 0;
+};
+
+/**
+ * Sums up values per bin. The function is called like the body of a linear \ref loop and returns the bin indices and
+ * the values of the index. The sums are added to the `bins` array, so that calls for several chunks (e.g. one per
+ * thread) accumulate into the same array, if they are serialized, or into private arrays, which are added up later.
+ * ~~~{.cpp}
+ * sa::binned_reduce<vec_size>(0, cells.size(), [&](auto i)
+ *   {
+ *     return std::pair(SIMD_ACCESS_V(zone, i), SIMD_ACCESS_V(volume, i));
+ *   }, zoneVolume.data(), zoneVolume.size());
+ * ~~~
+ * @tparam SimdSize Vector size.
+ * @tparam T Deduced value type of the bins.
+ * @param start Start of the iteration range [start, end).
+ * @param end End of the iteration range [start, end).
+ * @param fn Generic function taking either `index<SimdSize, IntegralType>` or `IntegralType` and returning a pair of
+ *   the bin index and the value (simds or scalars, respectively). Floating point bin indices are truncated.
+ * @param bins Array of the sums.
+ * @param binCount Number of bins.
+ */
+template<int SimdSize, class T>
+inline void binned_reduce(std::integral auto start, std::integral auto end, auto&& fn, T* bins, size_t binCount)
+{
+  replicated_bins<T, SimdSize> privateBins(binCount);
+  loop<SimdSize>(start, end, [&](auto i)
+    {
+      auto [bin, value] = fn(i);
+      privateBins.add(bin, value);
+    });
+  privateBins.add_to(bins);
+}
+
+/**
+ * Counts the indices per bin. The function is called like the body of a linear \ref loop and returns the bin indices
+ * of the index (simd or scalar). The counts are added to the `bins` array (see \ref binned_reduce).
+ * @tparam SimdSize Vector size.
+ * @tparam T Deduced type of the counts.
+ * @param start Start of the iteration range [start, end).
+ * @param end End of the iteration range [start, end).
+ * @param fn Generic function taking either `index<SimdSize, IntegralType>` or `IntegralType` and returning the bin
+ *   index. Floating point bin indices are truncated.
+ * @param bins Array of the counts.
+ * @param binCount Number of bins.
+ */
+template<int SimdSize, class T>
+inline void histogram(std::integral auto start, std::integral auto end, auto&& fn, T* bins, size_t binCount)
+{
+  binned_reduce<SimdSize>(start, end, [&](auto i) { return std::pair(fn(i), T(1)); }, bins, binCount);
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_HISTOGRAM
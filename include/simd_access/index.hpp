@@ -66,10 +66,50 @@ struct index
   }
 };
 
+/// Class representing a simd index to a sequence of elements with a constant distance.
+/**
+ * The scalar index of vector lane `i` is `index_ + i * stride_`. Strided indices are created by
+ * \ref classifying_loop for index vectors, which form an arithmetic progression.
+ * @tparam SimdSize Length of the simd sequence.
+ * @tparam IndexType Type of the scalar index.
+ */
+template<int SimdSize, class IndexType = size_t>
+struct strided_index
+{
+  /// Return the length of the simd sequence.
+  /**
+   * @return The length of the simd sequence.
+   */
+  static constexpr int size() { return SimdSize; }
+
+  /// Return the scalar index of a vector lane.
+  /**
+   * @param i Index in the vector must be in the range [0, SimdSize) .
+   * @return The scalar index at vector lane i, i.e. index_ + i * stride_.
+   */
+  auto scalar_index(int i) const { return IndexType(index_ + stride_ * i); }
+
+  /// The index, at which the sequence starts.
+  IndexType index_;
+  /// The distance between the indices of two neighboring vector lanes.
+  std::make_signed_t<IndexType> stride_;
+
+  /// Transforms this to a simd value.
+  /**
+   * @return The value represented by this transformed to a simd value.
+   */
+  auto to_simd() const
+  {
+    return stdx::fixed_size_simd<IndexType, SimdSize>([this](auto i){ return scalar_index(i); });
+  }
+};
+
 template<class PotentialIndexType>
 concept simd_index =
   (stdx_simd<PotentialIndexType> && std::is_integral_v<typename PotentialIndexType::value_type>) ||
-  requires(std::remove_cvref_t<PotentialIndexType> x) { []<int SimdSize, class IndexType>(index<SimdSize, IndexType>&){}(x); };
+  requires(std::remove_cvref_t<PotentialIndexType> x) { []<int SimdSize, class IndexType>(index<SimdSize, IndexType>&){}(x); } ||
+  requires(std::remove_cvref_t<PotentialIndexType> x)
+    { []<int SimdSize, class IndexType>(strided_index<SimdSize, IndexType>&){}(x); };
 
 /// TODO: Introduce masked_index to support e.g. residual masked loops.
 
@@ -87,6 +127,20 @@ inline auto scalar_index(const index<SimdSize, IndexType>& idx, auto i)
   return idx.scalar_index(i);
 }
 
+/// Returns the scalar index of a specific vector lane for a strided index.
+/**
+ * @tparam SimdSize Deduced simd size.
+ * @tparam IndexType Deduced type of the scalar index.
+ * @param idx Strided simd index.
+ * @param i Vector lane.
+ * @return The scalar index at vector lane `i`, i.e. `idx.index_ + i * idx.stride_`.
+ */
+template<int SimdSize, class IndexType>
+inline auto scalar_index(const strided_index<SimdSize, IndexType>& idx, auto i)
+{
+  return idx.scalar_index(i);
+}
+
 /// Returns the scalar index of a specific vector lane for an indirect index u.
 /**
  * @tparam IndexType Deduced integral type of the scalar index.
@@ -0,0 +1,188 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief A vector with inline storage for a bounded number of elements.
+ */
+
+#ifndef SIMD_ACCESS_INLINE_VECTOR
+#define SIMD_ACCESS_INLINE_VECTOR
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace simd_access
+{
+
+/// A vector, which stores up to `Capacity` elements inline and allocates heap memory only for larger sizes.
+/**
+ * `inline_vector` is the simdized type of `std::vector` members (see \ref simdized_vector_capacity), since
+ * structure-of-simd values are created for every loaded simd index. As long as the size doesn't exceed `Capacity`,
+ * creating, copying and destroying an `inline_vector` doesn't allocate.
+ * @tparam T Value type.
+ * @tparam Capacity Maximal number of elements stored inline.
+ * @tparam Allocator Allocator of the heap storage for more than `Capacity` elements.
+ */
+template<class T, size_t Capacity, class Allocator = std::allocator<T>>
+class inline_vector
+{
+public:
+  /// Type of the elements.
+  using value_type = T;
+  /// Type of sizes and indices.
+  using size_type = size_t;
+  /// Iterator type.
+  using iterator = T*;
+  /// Const iterator type.
+  using const_iterator = const T*;
+
+  /// Default constructor. Creates an empty vector.
+  inline_vector() = default;
+
+  /// Creates a vector of `size` value-initialized elements.
+  /**
+   * @param size Number of elements.
+   */
+  explicit inline_vector(size_t size)
+  {
+    resize(size);
+  }
+
+  /// Copy constructor.
+  inline_vector(const inline_vector& other) :
+    size_(other.size_),
+    overflow_data_(other.overflow_data_)
+  {
+    std::copy_n(other.inline_data_.begin(), other.inline_size(), inline_data_.begin());
+  }
+
+  /// Move constructor.
+  inline_vector(inline_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) :
+    size_(other.size_),
+    overflow_data_(std::move(other.overflow_data_))
+  {
+    std::move(other.inline_data_.begin(), other.inline_data_.begin() + other.inline_size(), inline_data_.begin());
+    other.size_ = 0;
+  }
+
+  /// Copy assignment.
+  inline_vector& operator=(const inline_vector& other)
+  {
+    if (this != &other)
+    {
+      size_ = other.size_;
+      overflow_data_ = other.overflow_data_;
+      std::copy_n(other.inline_data_.begin(), other.inline_size(), inline_data_.begin());
+    }
+    return *this;
+  }
+
+  /// Move assignment.
+  inline_vector& operator=(inline_vector&& other) noexcept(std::is_nothrow_move_assignable_v<T>)
+  {
+    if (this != &other)
+    {
+      size_ = other.size_;
+      overflow_data_ = std::move(other.overflow_data_);
+      std::move(other.inline_data_.begin(), other.inline_data_.begin() + other.inline_size(), inline_data_.begin());
+      other.size_ = 0;
+    }
+    return *this;
+  }
+
+  /// Number of elements.
+  size_t size() const { return size_; }
+  /// True, if there are no elements.
+  bool empty() const { return size_ == 0; }
+  /// Maximal number of elements, which are stored without heap allocation.
+  static constexpr size_t inline_capacity() { return Capacity; }
+
+  /// Pointer to the first element.
+  T* data() { return size_ > Capacity ? overflow_data_.data() : inline_data_.data(); }
+  /// Pointer to the first element.
+  const T* data() const { return size_ > Capacity ? overflow_data_.data() : inline_data_.data(); }
+
+  /// Iterator to the first element.
+  T* begin() { return data(); }
+  /// Iterator to the first element.
+  const T* begin() const { return data(); }
+  /// Iterator past the last element.
+  T* end() { return data() + size_; }
+  /// Iterator past the last element.
+  const T* end() const { return data() + size_; }
+
+  /// Element access.
+  /**
+   * @param i Element index.
+   * @return Reference to the element.
+   */
+  T& operator[](size_t i) { return data()[i]; }
+  /// Element access.
+  /**
+   * @param i Element index.
+   * @return Reference to the element.
+   */
+  const T& operator[](size_t i) const { return data()[i]; }
+
+  /// Changes the number of elements. New elements are value-initialized.
+  /**
+   * @param size New number of elements.
+   */
+  void resize(size_t size)
+  {
+    if (size > Capacity)
+    {
+      if (size_ <= Capacity)
+      {
+        overflow_data_.assign(inline_data_.begin(), inline_data_.begin() + size_);
+      }
+      overflow_data_.resize(size);
+    }
+    else
+    {
+      if (size_ > Capacity)
+      {
+        std::move(overflow_data_.begin(), overflow_data_.begin() + size, inline_data_.begin());
+        overflow_data_.clear();
+      }
+      else if (size > size_)
+      {
+        std::fill(inline_data_.begin() + size_, inline_data_.begin() + size, T());
+      }
+    }
+    size_ = size;
+  }
+
+private:
+  /// Number of elements in `inline_data_`.
+  size_t inline_size() const { return size_ > Capacity ? 0 : size_; }
+
+  /// Number of elements.
+  size_t size_ = 0;
+  /// Storage for up to `Capacity` elements.
+  std::array<T, Capacity> inline_data_;
+  /// Storage, if there are more than `Capacity` elements.
+  std::vector<T, Allocator> overflow_data_;
+};
+
+template<class T>
+concept inline_vector_type = requires(std::remove_cvref_t<T> x)
+  {
+    []<class U, size_t Capacity, class Allocator>(inline_vector<U, Capacity, Allocator>&){}(x);
+  };
+
+/// Number of elements of a simdized `std::vector<T>`, which are stored without heap allocation.
+/**
+ * Specialize this trait, if the `std::vector<T>` members of your structures are usually larger.
+ * @tparam T Value type of the scalar `std::vector`.
+ */
+template<class T>
+struct simdized_vector_capacity : std::integral_constant<size_t, 8> {};
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_INLINE_VECTOR
@@ -0,0 +1,331 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Interleaved execution of latency-bound loops with coroutines.
+ */
+
+#ifndef SIMD_ACCESS_INTERLEAVE
+#define SIMD_ACCESS_INTERLEAVE
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "simd_access/index.hpp"
+#include "simd_access/universal_simd.hpp"
+
+namespace simd_access
+{
+
+/// Recycles the frames of \ref interleaved_task coroutines.
+/**
+ * An interleaved loop creates one coroutine per iteration, but only a few of them are alive at the same time. Freed
+ * frames are kept in a list per thread and reused by the next coroutine of the same frame size.
+ * Frames are aligned to \ref alignment, since the compiler doesn't request over-aligned frames for simd variables
+ * living across suspension points.
+ */
+class frame_pool
+{
+public:
+  /// Alignment of the frames, which covers the simd types up to AVX-512.
+  static constexpr std::size_t alignment = 64;
+
+  /// Returns a frame of at least `size` bytes.
+  /**
+   * @param size Size of the coroutine frame.
+   * @return Pointer to the frame.
+   */
+  static void* allocate(std::size_t size)
+  {
+    auto& pool = instance();
+    for (block** b = &pool.free_; *b != nullptr; b = &(*b)->next_)
+    {
+      if ((*b)->size_ == size)
+      {
+        block* result = *b;
+        *b = result->next_;
+        return result;
+      }
+    }
+    return ::operator new(std::max(size, sizeof(block)), std::align_val_t(alignment));
+  }
+
+  /// Returns a frame to the pool.
+  /**
+   * @param frame Pointer to the frame.
+   * @param size Size of the coroutine frame.
+   */
+  static void deallocate(void* frame, std::size_t size)
+  {
+    auto& pool = instance();
+    pool.free_ = new(frame) block{pool.free_, size};
+  }
+
+  /// Destructor. Releases all pooled frames.
+  ~frame_pool()
+  {
+    while (free_ != nullptr)
+    {
+      void* frame = std::exchange(free_, free_->next_);
+      ::operator delete(frame, std::align_val_t(alignment));
+    }
+  }
+
+private:
+  /// A free frame.
+  struct block
+  {
+    /// Next free frame.
+    block* next_;
+    /// Size of the frame.
+    std::size_t size_;
+  };
+
+  /// Returns the pool of the calling thread.
+  static frame_pool& instance()
+  {
+    thread_local frame_pool pool;
+    return pool;
+  }
+
+  /// List of free frames.
+  block* free_ = nullptr;
+};
+
+/// Coroutine type of the loop bodies of \ref interleaved_loop.
+/**
+ * A task is created suspended and is resumed by the interleaved loop. It suspends at every `co_await fetch(...)`,
+ * which gives the other tasks of the loop the chance to run, while the prefetched memory is loaded.
+ */
+class interleaved_task
+{
+public:
+  /// Promise type of the coroutine.
+  struct promise_type
+  {
+    /// Creates the task object.
+    interleaved_task get_return_object()
+    {
+      return interleaved_task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    /// The task starts suspended.
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    /// The task stays suspended after completion, so that the loop can detect it.
+    std::suspend_always final_suspend() noexcept { return {}; }
+    /// Completes the task.
+    void return_void() {}
+    /// Stores an exception of the loop body, which is rethrown by the loop.
+    void unhandled_exception() { exception_ = std::current_exception(); }
+
+    /// Allocates the coroutine frame from the \ref frame_pool.
+    static void* operator new(std::size_t size) { return frame_pool::allocate(size); }
+    /// Returns the coroutine frame to the \ref frame_pool.
+    static void operator delete(void* frame, std::size_t size) { frame_pool::deallocate(frame, size); }
+
+    /// Exception thrown by the loop body.
+    std::exception_ptr exception_;
+  };
+
+  /// Default constructor. Creates an empty task.
+  interleaved_task() = default;
+
+  /// Move constructor.
+  interleaved_task(interleaved_task&& other) noexcept :
+    handle_(std::exchange(other.handle_, nullptr))
+  {}
+
+  /// Move assignment.
+  interleaved_task& operator=(interleaved_task&& other) noexcept
+  {
+    std::swap(handle_, other.handle_);
+    return *this;
+  }
+
+  /// Destructor. Destroys the coroutine.
+  ~interleaved_task()
+  {
+    if (handle_)
+    {
+      handle_.destroy();
+    }
+  }
+
+  /// Checks, whether the task holds a coroutine.
+  explicit operator bool() const { return bool(handle_); }
+
+  /// Resumes the coroutine until its next suspension point.
+  /**
+   * @return True, if the coroutine completed. An exception thrown by the coroutine is rethrown.
+   */
+  bool step()
+  {
+    handle_.resume();
+    if (!handle_.done())
+    {
+      return false;
+    }
+    if (handle_.promise().exception_)
+    {
+      std::rethrow_exception(handle_.promise().exception_);
+    }
+    return true;
+  }
+
+private:
+  /// Constructor.
+  /**
+   * @param handle Handle of the coroutine.
+   */
+  explicit interleaved_task(std::coroutine_handle<promise_type> handle) :
+    handle_(handle)
+  {}
+
+  /// Handle of the coroutine.
+  std::coroutine_handle<promise_type> handle_;
+};
+
+/// Awaitable returned by \ref fetch.
+/**
+ * @tparam T Type of the fetched value.
+ */
+template<class T>
+struct fetch_awaitable
+{
+  /// The prefetched pointer, reference wrapper or universal simd of them.
+  T value_;
+
+  /// Always suspends, since the data is not expected in the cache.
+  bool await_ready() const noexcept { return false; }
+  /// Nothing to do at suspension, the prefetches were issued by \ref fetch.
+  void await_suspend(std::coroutine_handle<>) const noexcept {}
+  /// Returns the fetched value.
+  T await_resume() const noexcept { return value_; }
+};
+
+/// Returns the address of the object referenced by a pointer. Null pointers may be passed.
+/**
+ * @tparam T Deduced object type.
+ * @param value Pointer to the object.
+ * @return `value`.
+ */
+template<class T>
+inline const void* fetch_address(T* value)
+{
+  return value;
+}
+
+/// Returns the address of the object referenced by a reference wrapper.
+/**
+ * @tparam T Deduced object type.
+ * @param value Reference wrapper of the object.
+ * @return `&value.get()`.
+ */
+template<class T>
+inline const void* fetch_address(std::reference_wrapper<T> value)
+{
+  return &value.get();
+}
+
+/// Prefetches the object referenced by a pointer (or by all lanes of a universal simd of pointers).
+/**
+ * Inside an \ref interleaved_task, `p = co_await fetch(p)` issues the prefetch and suspends the task. The task is
+ * resumed after the other tasks of the loop ran a step, when the object is expected in the cache.
+ * @tparam T Deduced type of the pointer, reference wrapper or universal simd of them.
+ * @param value Pointer, reference wrapper or universal simd of them.
+ * @return An awaitable returning `value`.
+ */
+template<class T>
+inline auto fetch(const T& value)
+{
+  if constexpr (any_simd<T>)
+  {
+    for (int i = 0; i < T::size(); ++i)
+    {
+      __builtin_prefetch(fetch_address(value[i]));
+    }
+  }
+  else
+  {
+    __builtin_prefetch(fetch_address(value));
+  }
+  return fetch_awaitable<T>{value};
+}
+
+/**
+ * Interleaves the iterations of a latency-bound loop (e.g. pointer chasing). `fn` is a coroutine returning an
+ * \ref interleaved_task. Up to `Groups` iterations are in flight at the same time. Each one runs until it awaits a
+ * \ref fetch, then the next one is resumed. Thus the cache misses of several iterations overlap. Like in the linear
+ * \ref loop, `fn` is called with `index<SimdSize, IndexType>` for full vectors and with an integral index for the
+ * residual iterations, so that every group traverses `SimdSize` chains in parallel.
+ * ~~~{.cpp}
+ * sa::interleaved_loop<vec_size>(0, heads.size(), [&](auto i) -> sa::interleaved_task
+ *   {
+ *     auto node = sa::generate_universal(i, [&](auto k) { return heads[k]; });
+ *     while (...)
+ *     {
+ *       node = co_await sa::fetch(SIMD_UNIVERSAL_ACCESS(node, ->next_));
+ *       ...
+ *     }
+ *   });
+ * ~~~
+ * @tparam SimdSize Vector size.
+ * @tparam Groups Number of iterations in flight.
+ * @param start Inclusive start of the range.
+ * @param end Exclusive end of the range.
+ * @param fn Coroutine called with the index of an iteration. It must outlive the loop, i.e. a lambda coroutine must
+ *   be passed as lvalue or as temporary of the call.
+ */
+template<int SimdSize, int Groups = 8>
+  requires (Groups > 0)
+inline void interleaved_loop(std::integral auto start, std::integral auto end, auto&& fn)
+{
+  using IndexType = std::common_type_t<decltype(start), decltype(end)>;
+  IndexType next = start;
+  auto create_task = [&]() -> interleaved_task
+    {
+      if (next + SimdSize <= IndexType(end))
+      {
+        index<SimdSize, IndexType> i{next};
+        next += SimdSize;
+        return fn(i);
+      }
+      if constexpr (SimdSize > 1)
+      {
+        if (next < IndexType(end))
+        {
+          return fn(next++);
+        }
+      }
+      return interleaved_task();
+    };
+  std::array<interleaved_task, Groups> tasks;
+  int active = 0;
+  for (auto& task : tasks)
+  {
+    task = create_task();
+    active += bool(task);
+  }
+  while (active > 0)
+  {
+    for (auto& task : tasks)
+    {
+      if (task && task.step())
+      {
+        task = create_task();
+        active -= !task;
+      }
+    }
+  }
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_INTERLEAVE
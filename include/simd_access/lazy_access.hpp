@@ -0,0 +1,271 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Lazy access to the members of simd-accessed structures.
+ *
+ * `SIMD_ACCESS_V(points, i)` loads all members of the accessed structures, even if only some of them are used.
+ * `lazy(SIMD_ACCESS(points, i))` instead returns a proxy, which loads a member on its first use and stores only the
+ * modified members back:
+ * ~~~{.cpp}
+ * auto p = simd_access::lazy(SIMD_ACCESS(points, i));
+ * p.modify([](auto& s) -> auto& { return s.y; }) *= p.get([](auto& s) -> auto& { return s.x; });
+ * // p.y is stored, when p goes out of scope
+ * ~~~
+ * Members are selected by accessors, i.e. generic functors returning a reference to a subobject. They are applied to
+ * the scalar structure as well as to the structure-of-simd value. For scalar indices, `lazy` returns a proxy with the
+ * same interface referencing the scalar structure.
+ */
+
+#ifndef SIMD_ACCESS_LAZY_ACCESS
+#define SIMD_ACCESS_LAZY_ACCESS
+
+#include <bitset>
+#include <type_traits>
+#include <utility>
+
+#include "simd_access/load_store.hpp"
+#include "simd_access/reflection.hpp"
+#include "simd_access/value_access.hpp"
+
+namespace simd_access
+{
+
+/// Proxy for a simd access to structures, which loads members on first use and stores modified members only.
+/**
+ * The members are cached in a structure-of-simd value. Loaded and modified members are tracked per scalar member,
+ * so accessors may select scalar members as well as nested structures or arrays. The modified members are stored
+ * by `flush` or by the destructor.
+ * @tparam Location Type of the location of the simd data.
+ * @tparam ElementSize Size of the array elements, which (or one of its members) are accessed by the simd index.
+ */
+template<class Location, size_t ElementSize>
+class lazy_access
+{
+  /// Type of the scalar structure.
+  using value_type = std::remove_const_t<typename Location::value_type>;
+  static_assert(std::is_trivially_copyable_v<value_type>, "lazy access requires members with a constant pitch");
+
+public:
+  /// Type of the structure-of-simd value.
+  using simd_type = decltype(simdized_value<Location::size()>(std::declval<value_type>()));
+
+  /// Constructor. Doesn't load anything.
+  /**
+   * @param location The location of the accessed structures.
+   */
+  explicit lazy_access(const Location& location) :
+    location_(location)
+  {}
+
+  lazy_access(const lazy_access&) = delete;
+  lazy_access& operator=(const lazy_access&) = delete;
+
+  /// Destructor. Stores all modified members.
+  ~lazy_access()
+  {
+    flush();
+  }
+
+  /// Returns a member for reading. The member is loaded, if it isn't loaded yet.
+  /**
+   * @param accessor Functor returning a reference to the member of a structure.
+   * @return Const reference to the simdized member.
+   */
+  const auto& get(auto&& accessor)
+  {
+    load_missing(accessor);
+    return std::as_const(accessor(cache_));
+  }
+
+  /// Returns a member for modification. The member is loaded, if it isn't loaded yet, and marked as modified.
+  /**
+   * @param accessor Functor returning a reference to the member of a structure.
+   * @return Reference to the simdized member.
+   */
+  auto& modify(auto&& accessor) requires(!std::is_const_v<typename Location::value_type>)
+  {
+    load_missing(accessor);
+    mark(accessor, dirty_);
+    return accessor(cache_);
+  }
+
+  /// Assigns a value to a member without loading it. The member is marked as modified.
+  /**
+   * @param accessor Functor returning a reference to the member of a structure.
+   * @param value The new value of the member.
+   */
+  void assign(auto&& accessor, const auto& value) requires(!std::is_const_v<typename Location::value_type>)
+  {
+    accessor(cache_) = value;
+    mark(accessor, loaded_);
+    mark(accessor, dirty_);
+  }
+
+  /// Checks, whether a member is loaded (or assigned).
+  /**
+   * @param accessor Functor returning a reference to the member of a structure.
+   * @return True, if all scalar members of the selected member are loaded.
+   */
+  bool is_loaded(auto&& accessor) const
+  {
+    return test(accessor, loaded_);
+  }
+
+  /// Checks, whether a member is modified and not stored yet.
+  /**
+   * @param accessor Functor returning a reference to the member of a structure.
+   * @return True, if any scalar member of the selected member is modified.
+   */
+  bool is_dirty(auto&& accessor) const
+  {
+    return !test(accessor, ~dirty_);
+  }
+
+  /// Stores all modified members.
+  void flush()
+  {
+    if constexpr (!std::is_const_v<typename Location::value_type>)
+    {
+      if (dirty_.none())
+      {
+        return;
+      }
+      simd_members([&](auto& scalar, const auto& source)
+        {
+          if (dirty_[offset(scalar)])
+          {
+            store<ElementSize>(location_.subobject_access(scalar), source);
+          }
+        }, *location_.base_, cache_);
+      dirty_.reset();
+    }
+  }
+
+private:
+  /// One bit per byte of the scalar structure. A scalar member is represented by the bit of its first byte.
+  using member_set = std::bitset<sizeof(value_type)>;
+
+  /// Returns the offset of a scalar member in the structure.
+  size_t offset(const auto& scalar) const
+  {
+    return reinterpret_cast<const char*>(&scalar) - reinterpret_cast<const char*>(location_.base_);
+  }
+
+  /// Loads all scalar members of a member, which aren't loaded yet.
+  void load_missing(auto&& accessor)
+  {
+    simd_members([&](auto& dest, const auto& scalar)
+      {
+        auto bit = offset(scalar);
+        if (!loaded_[bit])
+        {
+          dest = load<ElementSize>(location_.subobject_access(scalar));
+          loaded_[bit] = true;
+        }
+      }, accessor(cache_), accessor(*location_.base_));
+  }
+
+  /// Sets the bits of all scalar members of a member.
+  void mark(auto&& accessor, member_set& bits) const
+  {
+    simd_members([&](const auto& scalar) { bits[offset(scalar)] = true; }, accessor(*location_.base_));
+  }
+
+  /// Checks the bits of all scalar members of a member.
+  bool test(auto&& accessor, const member_set& bits) const
+  {
+    bool result = true;
+    simd_members([&](const auto& scalar) { result = result && bits[offset(scalar)]; }, accessor(*location_.base_));
+    return result;
+  }
+
+  /// The location of the accessed structures.
+  Location location_;
+  /// The loaded members.
+  simd_type cache_{};
+  /// Members, which are loaded or assigned.
+  member_set loaded_;
+  /// Members, which are modified and not stored yet.
+  member_set dirty_;
+};
+
+/// Proxy with the interface of \ref lazy_access for a scalar structure. All operations access the structure directly.
+/**
+ * @tparam T Type of the scalar structure.
+ */
+template<class T>
+class lazy_reference
+{
+public:
+  /// Constructor.
+  /**
+   * @param value The referenced structure.
+   */
+  explicit lazy_reference(T& value) :
+    value_(value)
+  {}
+
+  /// Returns a member for reading.
+  /**
+   * @param accessor Functor returning a reference to the member of a structure.
+   * @return Const reference to the member.
+   */
+  const auto& get(auto&& accessor) const { return std::as_const(accessor(value_)); }
+
+  /// Returns a member for modification.
+  /**
+   * @param accessor Functor returning a reference to the member of a structure.
+   * @return Reference to the member.
+   */
+  auto& modify(auto&& accessor) requires(!std::is_const_v<T>) { return accessor(value_); }
+
+  /// Assigns a value to a member.
+  /**
+   * @param accessor Functor returning a reference to the member of a structure.
+   * @param value The new value of the member.
+   */
+  void assign(auto&& accessor, const auto& value) requires(!std::is_const_v<T>) { accessor(value_) = value; }
+
+  /// A scalar structure is always loaded.
+  bool is_loaded(auto&&) const { return true; }
+
+  /// A scalar structure is never dirty.
+  bool is_dirty(auto&&) const { return false; }
+
+  /// Does nothing, since modifications are applied directly.
+  void flush() {}
+
+private:
+  /// The referenced structure.
+  T& value_;
+};
+
+/**
+ * Creates a lazy proxy for a simd access to structures.
+ * @tparam Location Deduced type of the location of the simd data.
+ * @tparam ElementSize Deduced size of the array elements.
+ * @param access A simd access as returned by `SIMD_ACCESS`.
+ * @return A \ref lazy_access object.
+ */
+template<class Location, size_t ElementSize>
+inline auto lazy(value_access<Location, ElementSize>&& access)
+{
+  return lazy_access<Location, ElementSize>(access.location());
+}
+
+/**
+ * Creates a lazy proxy for a scalar structure (i.e. the result of `SIMD_ACCESS` for a scalar index).
+ * @tparam T Deduced type of the scalar structure.
+ * @param value The structure.
+ * @return A \ref lazy_reference object.
+ */
+template<class T>
+inline auto lazy(T& value)
+{
+  return lazy_reference<T>(value);
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_LAZY_ACCESS
@@ -110,6 +110,220 @@ inline auto load(const indexed_location<T, SimdSize, ArrayType>& location)
     });
 }
 
+/**
+ * Stores a simd value to a memory location defined by a base address and a strided index. The simd elements are
+ * stored at the positions base, base+stride*ElementSize, base+2*stride*ElementSize, ...
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of a simd element.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @param location Address of the first element and stride of the memory location.
+ * @param source Simd value to be stored.
+ */
+template<size_t ElementSize, simd_arithmetic T, int SimdSize>
+inline void store(const strided_location<T, SimdSize>& location, const stdx::fixed_size_simd<T, SimdSize>& source)
+{
+  // scatter with constant pitch
+  for (int i = 0; i < SimdSize; ++i)
+  {
+    location.template lane<ElementSize>(i) = source[i];
+  }
+}
+
+/**
+ * Loads a simd value from a memory location defined by a base address and a strided index. The simd elements to be
+ * loaded are located at the positions base, base+stride*ElementSize, base+2*stride*ElementSize, ...
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of a simd element.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @param location Address of the first element and stride of the memory location.
+ * @return A simd value.
+ */
+template<size_t ElementSize, simd_arithmetic T, int SimdSize>
+inline auto load(const strided_location<T, SimdSize>& location)
+{
+  // gather with constant pitch
+  return stdx::fixed_size_simd<std::remove_const_t<T>, SimdSize>([&](int i)
+    {
+      return location.template lane<ElementSize>(i);
+    });
+}
+
+/**
+ * Converts a simd mask (or any type with a `bool`-convertible operator[]) to the mask type of
+ * `stdx::fixed_size_simd<T, SimdSize>`.
+ * @tparam T Value type of the simd type.
+ * @tparam SimdSize Vector size of the simd type.
+ * @param mask The mask.
+ * @return The converted mask.
+ */
+template<class T, int SimdSize>
+inline auto simd_mask_for(const auto& mask)
+{
+  using MaskType = typename stdx::fixed_size_simd<std::remove_const_t<T>, SimdSize>::mask_type;
+  if constexpr (std::is_same_v<std::remove_cvref_t<decltype(mask)>, MaskType>)
+  {
+    return mask;
+  }
+  else
+  {
+    MaskType result;
+    for (int i = 0; i < SimdSize; ++i)
+    {
+      result[i] = bool(mask[i]);
+    }
+    return result;
+  }
+}
+
+/**
+ * Stores the vector lanes of a simd value, which are selected by a mask, to a memory location defined by a base address
+ * and an linear index. The other elements are neither read nor written.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of a simd element.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @param location Address of the memory location, at which the first simd element is stored.
+ * @param mask Simd mask selecting the stored lanes.
+ * @param source Simd value to be stored.
+ */
+template<size_t ElementSize, simd_arithmetic T, int SimdSize>
+inline void masked_store(const linear_location<T, SimdSize>& location, const auto& mask,
+  const stdx::fixed_size_simd<T, SimdSize>& source)
+{
+  if constexpr (sizeof(T) == ElementSize)
+  {
+    stdx::where(simd_mask_for<T, SimdSize>(mask), source).copy_to(location.base_, stdx::element_aligned);
+  }
+  else
+  {
+    for (int i = 0; i < SimdSize; ++i)
+    {
+      if (mask[i])
+      {
+        location.template lane<ElementSize>(i) = source[i];
+      }
+    }
+  }
+}
+
+/**
+ * Stores the vector lanes of a simd value, which are selected by a mask, to a memory location defined by a base address
+ * and an indirect index. The other elements are neither read nor written.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of a simd element.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @tparam ArrayType Deduced type of the array storing the indices.
+ * @param location Address and indices of the memory location.
+ * @param mask Simd mask selecting the stored lanes.
+ * @param source Simd value to be stored.
+ */
+template<size_t ElementSize, simd_arithmetic T, int SimdSize, class ArrayType>
+inline void masked_store(const indexed_location<T, SimdSize, ArrayType>& location, const auto& mask,
+  const stdx::fixed_size_simd<T, SimdSize>& source)
+{
+  // lane by lane, only the selected lanes are written
+  for (int i = 0; i < SimdSize; ++i)
+  {
+    if (mask[i])
+    {
+      location.template lane<ElementSize>(i) = source[i];
+    }
+  }
+}
+
+/**
+ * Loads the vector lanes, which are selected by a mask, from a memory location defined by a base address and an
+ * linear index. The other elements aren't read, their values are zero.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of a simd element.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @param location Address of the memory location, at which the first scalar element is stored.
+ * @param mask Simd mask selecting the loaded lanes.
+ * @return A simd value.
+ */
+template<size_t ElementSize, simd_arithmetic T, int SimdSize>
+inline auto masked_load(const linear_location<T, SimdSize>& location, const auto& mask)
+{
+  stdx::fixed_size_simd<std::remove_const_t<T>, SimdSize> result(0);
+  if constexpr (sizeof(T) == ElementSize)
+  {
+    stdx::where(simd_mask_for<T, SimdSize>(mask), result).copy_from(location.base_, stdx::element_aligned);
+  }
+  else
+  {
+    for (int i = 0; i < SimdSize; ++i)
+    {
+      if (mask[i])
+      {
+        result[i] = location.template lane<ElementSize>(i);
+      }
+    }
+  }
+  return result;
+}
+
+/**
+ * Loads the vector lanes, which are selected by a mask, from a memory location defined by a base address and an
+ * indirect index. The other elements aren't read, their values are zero.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of a simd element.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @tparam ArrayType Deduced type of the array storing the indices.
+ * @param location Address and indices of the memory location.
+ * @param mask Simd mask selecting the loaded lanes.
+ * @return A simd value.
+ */
+template<size_t ElementSize, simd_arithmetic T, int SimdSize, class ArrayType>
+inline auto masked_load(const indexed_location<T, SimdSize, ArrayType>& location, const auto& mask)
+{
+  // lane by lane, only the selected lanes are read
+  return stdx::fixed_size_simd<std::remove_const_t<T>, SimdSize>([&](int i)
+    {
+      return mask[i] ? location.template lane<ElementSize>(i) : std::remove_const_t<T>(0);
+    });
+}
+
+/**
+ * Stores the vector lanes of a simd value, which are selected by a mask, to a memory location defined by a base address
+ * and a strided index. The other elements are neither read nor written.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of a simd element.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @param location Address of the first element and stride of the memory location.
+ * @param mask Simd mask selecting the stored lanes.
+ * @param source Simd value to be stored.
+ */
+template<size_t ElementSize, simd_arithmetic T, int SimdSize>
+inline void masked_store(const strided_location<T, SimdSize>& location, const auto& mask,
+  const stdx::fixed_size_simd<T, SimdSize>& source)
+{
+  for (int i = 0; i < SimdSize; ++i)
+  {
+    if (mask[i])
+    {
+      location.template lane<ElementSize>(i) = source[i];
+    }
+  }
+}
+
+/**
+ * Loads the vector lanes, which are selected by a mask, from a memory location defined by a base address and a
+ * strided index. The other elements aren't read, their values are zero.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of a simd element.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @param location Address of the first element and stride of the memory location.
+ * @param mask Simd mask selecting the loaded lanes.
+ * @return A simd value.
+ */
+template<size_t ElementSize, simd_arithmetic T, int SimdSize>
+inline auto masked_load(const strided_location<T, SimdSize>& location, const auto& mask)
+{
+  return stdx::fixed_size_simd<std::remove_const_t<T>, SimdSize>([&](int i)
+    {
+      return mask[i] ? location.template lane<ElementSize>(i) : std::remove_const_t<T>(0);
+    });
+}
+
 /**
  * Creates a simd value from rvalues returned by the operator[] applied to `base`.
  * @tparam BaseType Type of an simd element.
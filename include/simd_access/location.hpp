@@ -8,6 +8,7 @@
 #ifndef SIMD_ACCESS_LOCATION
 #define SIMD_ACCESS_LOCATION
 
+#include <cstddef>
 #include <type_traits>
 
 namespace simd_access
@@ -26,6 +27,9 @@ struct linear_location
   /// Pointer to the first element of the sequence.
   T* base_;
 
+  /// Returns the length of the simd sequence.
+  static constexpr int size() { return SimdSize; }
+
   /// Experimental creation of a linear location for a member of `T`.
   /**
    * @tparam Member Pointer to a member variable of `T`.
@@ -46,6 +50,31 @@ struct linear_location
   {
     return linear_location<std::remove_reference_t<decltype((*base_)[i])>, SimdSize>{&((*base_)[i])};
   }
+
+  /// Creation of a linear location for an arbitrary subobject of `T`.
+  /**
+   * @tparam U Deduced type of the subobject.
+   * @param subobject Subobject of `*base_`.
+   * @return A new `linear_location` with `subobject` as first element.
+   */
+  template<class U>
+  auto subobject_access(U& subobject) const
+  {
+    return linear_location<U, SimdSize>{&subobject};
+  }
+
+  /// Returns the element of a vector lane.
+  /**
+   * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+   * @param i Vector lane.
+   * @return Reference to the element at `base_ + i * ElementSize`.
+   */
+  template<size_t ElementSize>
+  T& lane(int i) const
+  {
+    using byte_type = std::conditional_t<std::is_const_v<T>, const char, char>;
+    return *reinterpret_cast<T*>(reinterpret_cast<byte_type*>(base_) + ElementSize * i);
+  }
 };
 
 /// Specifies a location for a simd variable with the indices of its values stored in an array.
@@ -64,6 +93,9 @@ struct indexed_location
   /// Reference to the index array.
   const ArrayType& indices_;
 
+  /// Returns the length of the simd sequence.
+  static constexpr int size() { return SimdSize; }
+
   /// Experimental creation of an indexed location for a member of `T`.
   /**
    * @tparam Member Pointer to a member variable of `T`.
@@ -86,6 +118,97 @@ struct indexed_location
     return indexed_location<std::remove_reference_t<decltype((*base_)[i])>, SimdSize, ArrayType>
       {&((*base_)[i]), indices_};
   }
+
+  /// Creation of an indexed location for an arbitrary subobject of `T`.
+  /**
+   * @tparam U Deduced type of the subobject.
+   * @param subobject Subobject of `*base_`.
+   * @return A new `indexed_location` with `subobject` as element zero.
+   */
+  template<class U>
+  auto subobject_access(U& subobject) const
+  {
+    return indexed_location<U, SimdSize, ArrayType>{&subobject, indices_};
+  }
+
+  /// Returns the element of a vector lane.
+  /**
+   * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+   * @param i Vector lane.
+   * @return Reference to the element at `base_ + indices_[i] * ElementSize`.
+   */
+  template<size_t ElementSize>
+  T& lane(int i) const
+  {
+    using byte_type = std::conditional_t<std::is_const_v<T>, const char, char>;
+    return *reinterpret_cast<T*>(reinterpret_cast<byte_type*>(base_) + ElementSize * indices_[i]);
+  }
+};
+
+/// Specifies a location for a simd variable stored in memory as a sequence of elements with a constant distance.
+/**
+ * @tparam T Value type of the simd variable.
+ * @tparam SimdSize Length of the simd sequence.
+ */
+template<class T, int SimdSize>
+struct strided_location
+{
+  /// Generalized access to `T`.
+  using value_type = T;
+  /// Pointer to the first element of the sequence.
+  T* base_;
+  /// Distance between two elements of the sequence in units of the simd-indexed element.
+  std::ptrdiff_t stride_;
+
+  /// Returns the length of the simd sequence.
+  static constexpr int size() { return SimdSize; }
+
+  /// Experimental creation of a strided location for a member of `T`.
+  /**
+   * @tparam Member Pointer to a member variable of `T`.
+   * @return A new `strided_location` with `base->*Member` as first element.
+   */
+  template<auto Member>
+  auto member_access() const
+  {
+    return strided_location<std::remove_reference_t<decltype(std::declval<T>().*Member)>, SimdSize>
+      {&(base_->*Member), stride_};
+  }
+
+  /// Creation of a strided location for an element of `T`, if `T` is an array.
+  /**
+   * @param i Array element index.
+   * @return A new `strided_location` with `(*base)[i]` as first element.
+   */
+  auto array_access(auto i) const
+  {
+    return strided_location<std::remove_reference_t<decltype((*base_)[i])>, SimdSize>{&((*base_)[i]), stride_};
+  }
+
+  /// Creation of a strided location for an arbitrary subobject of `T`.
+  /**
+   * @tparam U Deduced type of the subobject.
+   * @param subobject Subobject of `*base_`.
+   * @return A new `strided_location` with `subobject` as first element.
+   */
+  template<class U>
+  auto subobject_access(U& subobject) const
+  {
+    return strided_location<U, SimdSize>{&subobject, stride_};
+  }
+
+  /// Returns the element of a vector lane.
+  /**
+   * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+   * @param i Vector lane.
+   * @return Reference to the element at `base_ + i * stride_ * ElementSize`.
+   */
+  template<size_t ElementSize>
+  T& lane(int i) const
+  {
+    using byte_type = std::conditional_t<std::is_const_v<T>, const char, char>;
+    return *reinterpret_cast<T*>(reinterpret_cast<byte_type*>(base_) + std::ptrdiff_t(ElementSize) * stride_ * i);
+  }
 };
 
 } //namespace simd_access
@@ -0,0 +1,227 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief A memory-mapped file as a vector with simd access (POSIX only).
+ */
+
+#ifndef SIMD_ACCESS_MAPPED_VECTOR
+#define SIMD_ACCESS_MAPPED_VECTOR
+
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "simd_access/vector.hpp"
+
+namespace simd_access
+{
+
+/// Access pattern hints for a memory-mapped range (see `madvise`).
+enum class access_advice
+{
+  /// No special treatment.
+  normal = MADV_NORMAL,
+  /// The range is traversed in ascending order, e.g. by a linear `loop`. Enables aggressive read-ahead.
+  sequential = MADV_SEQUENTIAL,
+  /// The range is accessed in random order, e.g. by an indirect `loop`. Disables read-ahead.
+  random = MADV_RANDOM,
+  /// The range will be accessed soon. Starts reading it in the background.
+  will_need = MADV_WILLNEED,
+  /// The range won't be accessed in the near future. Its pages may be released.
+  dont_need = MADV_DONTNEED
+};
+
+/// A contiguous array of elements, which resides in a memory-mapped file.
+/**
+ * The file is mapped shared, i.e. there is no read or copy step and no heap allocation. Writes become visible in
+ * the file. If `T` is const, the file is mapped read-only.
+ * @tparam T Value type. Must be trivially copyable.
+ */
+template<class T>
+class mapped_array
+{
+  static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types can be mapped");
+
+public:
+  /// Type of the elements.
+  using value_type = T;
+  /// Type of sizes and indices.
+  using size_type = size_t;
+  /// Iterator type.
+  using iterator = T*;
+
+  /// Maps an existing file. The file size is truncated to a multiple of `sizeof(T)`.
+  /**
+   * @param path Path to the file.
+   */
+  explicit mapped_array(const std::filesystem::path& path)
+  {
+    auto fd = open_file(path, std::is_const_v<T> ? O_RDONLY : O_RDWR);
+    struct stat fileStatus;
+    if (::fstat(fd, &fileStatus) != 0)
+    {
+      close_and_throw(fd, "fstat");
+    }
+    map(fd, size_t(fileStatus.st_size) / sizeof(T));
+  }
+
+  /// Creates (or truncates) a file of `size` elements and maps it.
+  /**
+   * @param path Path to the file.
+   * @param size Number of elements. The initial values are zero.
+   */
+  mapped_array(const std::filesystem::path& path, size_t size) requires(!std::is_const_v<T>)
+  {
+    auto fd = open_file(path, O_RDWR | O_CREAT | O_TRUNC);
+    if (::ftruncate(fd, off_t(size * sizeof(T))) != 0)
+    {
+      close_and_throw(fd, "ftruncate");
+    }
+    map(fd, size);
+  }
+
+  /// Move constructor.
+  mapped_array(mapped_array&& other) noexcept :
+    data_(std::exchange(other.data_, nullptr)),
+    size_(std::exchange(other.size_, 0))
+  {}
+
+  /// Move assignment.
+  mapped_array& operator=(mapped_array&& other) noexcept
+  {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+
+  mapped_array(const mapped_array&) = delete;
+  mapped_array& operator=(const mapped_array&) = delete;
+
+  /// Destructor. Unmaps the file.
+  ~mapped_array()
+  {
+    if (data_ != nullptr)
+    {
+      ::munmap(const_cast<std::remove_const_t<T>*>(data_), size_ * sizeof(T));
+    }
+  }
+
+  /// Number of elements.
+  size_t size() const { return size_; }
+  /// True, if there are no elements.
+  bool empty() const { return size_ == 0; }
+  /// Pointer to the first element.
+  T* data() const { return data_; }
+  /// Iterator to the first element.
+  T* begin() const { return data_; }
+  /// Iterator past the last element.
+  T* end() const { return data_ + size_; }
+
+  /// Scalar element access.
+  /**
+   * @param i Element index.
+   * @return Reference to the element.
+   */
+  T& operator[](size_t i) const { return data_[i]; }
+
+  /// Gives the operating system a hint about the access pattern of a range of elements.
+  /**
+   * The hint should match the loop, which traverses the range next: `access_advice::sequential` for linear loops,
+   * `access_advice::random` for indirect loops.
+   * @param advice The access pattern.
+   * @param first First element of the range.
+   * @param last Element past the range.
+   */
+  void advise(access_advice advice, size_t first, size_t last) const
+  {
+    if (first >= last)
+    {
+      return;
+    }
+    static const auto pageSize = std::uintptr_t(::sysconf(_SC_PAGESIZE));
+    auto begin = reinterpret_cast<std::uintptr_t>(data_ + first) & ~(pageSize - 1);
+    auto end = reinterpret_cast<std::uintptr_t>(data_ + last);
+    // The advice is only a hint, a failure doesn't affect correctness.
+    ::madvise(reinterpret_cast<void*>(begin), end - begin, int(advice));
+  }
+
+  /// Gives the operating system a hint about the access pattern of all elements.
+  /**
+   * @param advice The access pattern.
+   */
+  void advise(access_advice advice) const
+  {
+    advise(advice, 0, size_);
+  }
+
+  /// Synchronously writes modified elements back to the file.
+  void sync() const requires(!std::is_const_v<T>)
+  {
+    if (data_ != nullptr && ::msync(data_, size_ * sizeof(T), MS_SYNC) != 0)
+    {
+      throw std::system_error(errno, std::generic_category(), "msync");
+    }
+  }
+
+private:
+  /// Opens a file.
+  static int open_file(const std::filesystem::path& path, int flags)
+  {
+    auto fd = ::open(path.c_str(), flags, 0644);
+    if (fd < 0)
+    {
+      throw std::system_error(errno, std::generic_category(), "open " + path.string());
+    }
+    return fd;
+  }
+
+  /// Closes a file and throws the error, which occured before.
+  [[noreturn]] static void close_and_throw(int fd, const char* what)
+  {
+    auto error = errno;
+    ::close(fd);
+    throw std::system_error(error, std::generic_category(), what);
+  }
+
+  /// Maps `size` elements of an opened file and closes the file descriptor (the mapping stays valid).
+  void map(int fd, size_t size)
+  {
+    if (size > 0)
+    {
+      auto protection = std::is_const_v<T> ? PROT_READ : PROT_READ | PROT_WRITE;
+      auto address = ::mmap(nullptr, size * sizeof(T), protection, MAP_SHARED, fd, 0);
+      if (address == MAP_FAILED)
+      {
+        close_and_throw(fd, "mmap");
+      }
+      data_ = static_cast<T*>(address);
+      size_ = size;
+    }
+    ::close(fd);
+  }
+
+  /// Address of the mapping.
+  T* data_ = nullptr;
+  /// Number of mapped elements.
+  size_t size_ = 0;
+};
+
+/// A memory-mapped file with an overloaded operator[] for simd indices.
+/**
+ * @tparam T Value type. If const, the file is mapped read-only.
+ */
+template<class T>
+using mapped_vector = index_operator<mapped_array<T>>;
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_MAPPED_VECTOR
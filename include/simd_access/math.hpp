@@ -0,0 +1,574 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Vectorized exponential, logarithm, power and error functions.
+ *
+ * The `stdx` overloads of these functions call the scalar function for every lane (as \ref elementwise does). The
+ * functions of this file evaluate polynomial approximations on the whole vector instead. They are provided for
+ * `stdx::simd` types of `float` and `double` and for scalar `float` and `double`, where they call the `std` function,
+ * so that the same loop body compiles for simd and scalar indices. The accuracy is selected by a template parameter:
+ * ~~~{.cpp}
+ * auto rate = sa::exp<sa::math_accuracy::ulp4>(-activation / temperature);
+ * ~~~
+ * The `float` version of `erf` is computed in double precision.
+ */
+
+#ifndef SIMD_ACCESS_MATH
+#define SIMD_ACCESS_MATH
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <experimental/bits/simd.h>
+#include <limits>
+#include <type_traits>
+
+#include "simd_access/base.hpp"
+
+namespace simd_access
+{
+
+/// Maximum error of the vectorized math functions in units in the last place.
+enum class math_accuracy
+{
+  /// At most 1 ULP.
+  ulp1,
+  /// At most 4 ULP. Cheaper approximations are used, where they suffice.
+  ulp4
+};
+
+///@cond
+template<class T>
+concept math_simd = stdx_simd<T> && std::floating_point<typename T::value_type>;
+
+// Signed integer simd type with the same lane size as the floating point simd type V.
+template<class V>
+using math_int_simd = stdx::rebind_simd_t<
+  std::conditional_t<sizeof(typename V::value_type) == 8, std::int64_t, std::int32_t>, V>;
+
+// Simd type of the ABI deduced for the size of V. The operations of `fixed_size_simd` types (as returned by
+// SIMD_ACCESS_V) are implemented as tuples of native simds, which GCC often doesn't inline in larger functions. Hence
+// the functions are computed in the deduced ABI, which is the native one, if a native register fits.
+template<class V>
+using math_deduced_simd = stdx::simd<typename V::value_type,
+  stdx::simd_abi::deduce_t<typename V::value_type, V::size()>>;
+
+// Reinterprets the bits of every lane.
+template<class To, class From>
+inline To math_bit_cast(const From& x)
+{
+  typename From::value_type source[From::size()];
+  typename To::value_type dest[To::size()];
+  x.copy_to(source, stdx::element_aligned);
+  std::memcpy(dest, source, sizeof(source));
+  return To(dest, stdx::element_aligned);
+}
+
+// Returns x with the lower half of its mantissa bits cleared. Unlike Veltkamp's splitting this can't be broken by
+// the contraction of floating point expressions.
+template<class V>
+inline V math_split_high(const V& x)
+{
+  using IntType = math_int_simd<V>;
+  using IntValueType = typename IntType::value_type;
+  constexpr int lowBits = (std::numeric_limits<typename V::value_type>::digits + 1) / 2;
+  return math_bit_cast<V>(math_bit_cast<IntType>(x) & IntType(~((IntValueType(1) << lowBits) - 1)));
+}
+
+// Computes hi + lo == a * b (up to an error of the size of the last bits of lo).
+template<class V>
+inline void math_two_product(const V& a, const V& b, V& hi, V& lo)
+{
+  hi = a * b;
+  V aHigh = math_split_high(a), aLow = a - aHigh;
+  V bHigh = math_split_high(b), bLow = b - bHigh;
+  lo = ((aHigh * bHigh - hi) + aHigh * bLow + aLow * bHigh) + aLow * bLow;
+}
+
+// Computes hi + lo == a + b exactly.
+template<class V>
+inline void math_two_sum(const V& a, const V& b, V& hi, V& lo)
+{
+  hi = a + b;
+  V bVirtual = hi - a;
+  lo = (a - (hi - bVirtual)) + (b - bVirtual);
+}
+
+// Computes a * b + c with a single rounding. Without fused multiply-add instructions, it is emulated with the
+// error-free transformations above, which is exact up to the last bits of the product's error term.
+template<class V>
+inline V math_fused_multiply_add(const V& a, const V& b, const V& c)
+{
+#ifdef __FMA__
+  return stdx::fma(a, b, c);
+#else
+  V product, productLow, sum, sumLow;
+  math_two_product(a, b, product, productLow);
+  math_two_sum(c, product, sum, sumLow);
+  // a zero correction would turn -0 into +0, a non-finite one stems from infinite operands
+  V correction = sumLow + productLow;
+  stdx::where(correction != 0 && stdx::isfinite(correction), sum) += correction;
+  return sum;
+#endif
+}
+
+// Computes a * b + c. The ulp1 error bounds rely on a single rounding. Otherwise the contraction is left to the
+// compiler.
+template<math_accuracy Accuracy, class V>
+inline V math_multiply_add(const V& a, const V& b, const V& c)
+{
+  if constexpr (Accuracy == math_accuracy::ulp1)
+  {
+    return math_fused_multiply_add(a, b, c);
+  }
+  else
+  {
+    return a * b + c;
+  }
+}
+
+// Evaluates c[0] + c[1] * x + ... + c[N - 1] * x^(N - 1). For ulp1 every Horner step is rounded once.
+template<math_accuracy Accuracy = math_accuracy::ulp4, class V, class C, std::size_t N>
+inline V math_polynomial(const V& x, const std::array<C, N>& c)
+{
+  V result(c[N - 1]);
+  for (std::size_t i = N - 1; i-- > 0;)
+  {
+    result = math_multiply_add<Accuracy>(result, x, V(c[i]));
+  }
+  return result;
+}
+
+// Computes exp(hi + lo) for a small correction lo. Arguments outside of the finite range yield 0 or infinity.
+template<math_accuracy Accuracy, class V>
+inline V math_exp(const V& hi, const V& lo)
+{
+  using T = typename V::value_type;
+  using IntType = math_int_simd<V>;
+  using IntValueType = typename IntType::value_type;
+  constexpr bool isDouble = std::is_same_v<T, double>;
+  constexpr T log2e = T(1.4426950408889634);
+  // ln(2) split into a part with trailing zeros, whose products with k are exact, and the rest
+  constexpr T ln2High = isDouble ? T(6.93147180369123816490e-01) : T(0.693145751953125);
+  constexpr T ln2Low = isDouble ? T(1.90821492927058770002e-10) : T(1.428606765330187045e-06);
+  constexpr T maxArg = isDouble ? T(709.782712893384) : T(88.72283935546875);
+  constexpr T minArg = isDouble ? T(-745.1332191019412) : T(-103.97208);
+  constexpr int mantissaBits = std::numeric_limits<T>::digits - 1;
+  constexpr IntValueType bias = std::numeric_limits<T>::max_exponent - 1;
+
+  // exp(x) = 2^k * exp(r) with |r| <= ln(2) / 2
+  V x = stdx::min(stdx::max(hi, V(minArg)), V(maxArg));
+  V k = stdx::floor(x * log2e + T(0.5));
+  // the product of k and ln2High is exact
+  V rHigh = x - k * ln2High;
+  V rLow = lo - k * ln2Low;
+  V r = rHigh + rLow;
+  V q;
+  if constexpr (isDouble && Accuracy == math_accuracy::ulp1)
+  {
+    q = math_polynomial(r, std::array{ 0.5, 0.1666666666666667, 0.04166666666666667, 0.008333333333326141,
+      0.0013888888888883752, 0.00019841269874800493, 2.4801587325533363e-05, 2.7557255425746435e-06,
+      2.7557273661348637e-07, 2.510520637395701e-08, 2.0914679376583935e-09 });
+  }
+  else if constexpr (isDouble)
+  {
+    q = math_polynomial(r, std::array{ 0.5000000000000001, 0.16666666666666669, 0.041666666666624164,
+      0.008333333333330065, 0.0013888888917196719, 0.00019841269863040545, 2.4801521322368692e-05,
+      2.7557268480310024e-06, 2.7620075879983367e-07, 2.5100375832561234e-08 });
+  }
+  else if constexpr (Accuracy == math_accuracy::ulp1)
+  {
+    q = math_polynomial(r, std::array{ 0.5f, 0.1666666716337204f, 0.04166646674275398f, 0.00833331048488617f,
+      0.0013933641603216529f, 0.00019890980911441147f });
+  }
+  else
+  {
+    q = math_polynomial(r, std::array{ 0.5f, 0.16666577756404877f, 0.041666556149721146f, 0.008363173343241215f,
+      0.0013926175888627768f });
+  }
+  V result;
+  if constexpr (Accuracy == math_accuracy::ulp1)
+  {
+    // exp(r) = 1 + r + r^2 * q is summed up with extra precision, so that only the final addition rounds
+    V t, tLow;
+    math_two_sum(rHigh, rLow + r * r * q, t, tLow);
+    result = T(1) + t;
+    result += ((T(1) - result) + t) + tLow;
+  }
+  else
+  {
+    result = T(1) + (r + r * r * q);
+  }
+
+  // 2^k is applied in two factors, so that neither of them overflows or underflows
+  auto intK = stdx::static_simd_cast<IntType>(k);
+  auto k1 = intK >> 1;
+  result *= math_bit_cast<V>((k1 + bias) << mantissaBits);
+  result *= math_bit_cast<V>((intK - k1 + bias) << mantissaBits);
+  stdx::where(hi > maxArg, result) = std::numeric_limits<T>::infinity();
+  stdx::where(hi < minArg, result) = T(0);
+  stdx::where(hi != hi, result) = hi;
+  return result;
+}
+
+// Computes log(x) for positive finite x. If lo is given, the result is returned as hi + *lo, which is accurate far
+// beyond 1 ULP of hi with ulp1 accuracy.
+template<math_accuracy Accuracy, class V>
+inline V math_log(const V& x, V* lo = nullptr)
+{
+  using T = typename V::value_type;
+  using IntType = math_int_simd<V>;
+  using IntValueType = typename IntType::value_type;
+  constexpr bool isDouble = std::is_same_v<T, double>;
+  constexpr T ln2High = isDouble ? T(6.93147180369123816490e-01) : T(0.693145751953125);
+  constexpr T ln2Low = isDouble ? T(1.90821492927058770002e-10) : T(1.428606765330187045e-06);
+  constexpr int mantissaBits = std::numeric_limits<T>::digits - 1;
+  constexpr IntValueType bias = std::numeric_limits<T>::max_exponent - 1;
+
+  // x = 2^e * m with sqrt(1/2) <= m < sqrt(2), subnormal numbers are scaled to normal numbers first
+  constexpr int subnormalShift = mantissaBits + 2;
+  V scaled = x;
+  auto subnormal = x < std::numeric_limits<T>::min();
+  stdx::where(subnormal, scaled) *= T(IntValueType(1) << subnormalShift);
+  auto bits = math_bit_cast<IntType>(scaled);
+  V ed = stdx::static_simd_cast<V>((bits >> mantissaBits) - bias);
+  stdx::where(subnormal, ed) -= T(subnormalShift);
+  V m = math_bit_cast<V>((bits & IntType((IntValueType(1) << mantissaBits) - 1)) | IntType(bias << mantissaBits));
+  auto large = m > T(1.4142135623730951);
+  stdx::where(large, m) *= T(0.5);
+  stdx::where(large, ed) += T(1);
+
+  // log(m) = 2 * atanh(s) = 2 * s + 2 * s^3 / 3 + s^5 * P(s^2) with s = f / (2 + f)
+  V f = m - T(1);
+  V d = T(2) + f;
+  V s = f / d;
+  if constexpr (Accuracy == math_accuracy::ulp1)
+  {
+    // rounding error of s, d - 2 is exact
+    V dLow = f - (d - T(2));
+    V product, productLow;
+    math_two_product(s, d, product, productLow);
+    V sLow = ((f - product) - productLow - s * dLow) / d;
+    // 2 * s^3 / 3 contributes up to 2% and is computed with extra precision
+    constexpr T twoThirdsHigh = T(2.0 / 3.0);
+    constexpr T twoThirdsLow = T(2.0L / 3.0L - (long double)(twoThirdsHigh));
+    V z, zLow, cube, cubeLow, cubeTerm, cubeTermLow;
+    math_two_product(s, s, z, zLow);
+    math_two_product(s, z, cube, cubeLow);
+    cubeLow += s * zLow;
+    math_two_product(cube, V(twoThirdsHigh), cubeTerm, cubeTermLow);
+    cubeTermLow += cube * twoThirdsLow + cubeLow * twoThirdsHigh;
+    V tail;
+    if constexpr (isDouble)
+    {
+      tail = cube * z * math_polynomial(z, std::array{ 0.4, 0.28571428571428564, 0.22222222222228424,
+        0.18181818179658246, 0.15384615760977463, 0.13333296549572363, 0.11766812466114947, 0.10456341945425285,
+        0.10762291418628644 });
+    }
+    else
+    {
+      tail = cube * z * math_polynomial(z, std::array{ 0.4f, 0.2857142857f, 0.2222222222f, 0.1818181818f });
+    }
+    // e * ln2High + 2 * s + 2 * s^3 / 3, the product of e and ln2High is exact
+    V sum, sumLow, result, resultLow;
+    math_two_sum(ed * ln2High, T(2) * s, sum, sumLow);
+    math_two_sum(sum, cubeTerm, result, resultLow);
+    V low = sumLow + resultLow + cubeTermLow + T(2) * sLow * (T(1) + z) + tail + ed * ln2Low;
+    sum = result;
+    result += low;
+    if (lo != nullptr)
+    {
+      *lo = low - (result - sum);
+    }
+    return result;
+  }
+  else
+  {
+    V z = s * s;
+    V correction;
+    if constexpr (isDouble)
+    {
+      correction = s * z * math_polynomial(z, std::array{ 0.666666666666667, 0.39999999999899505,
+        0.28571428625975487, 0.2222221113479508, 0.18182889125261723, 0.15331721600556042, 0.14616449685043406 });
+    }
+    else
+    {
+      correction = s * z * math_polynomial(z, std::array{ 0.6666668653488159f, 0.3998878002166748f,
+        0.29579949378967285f });
+    }
+    if (lo != nullptr)
+    {
+      *lo = V(0);
+    }
+    return ed * ln2High + (T(2) * s + (correction + ed * ln2Low));
+  }
+}
+///@endcond
+
+/// Vectorized exponential function. Overloaded for scalar values.
+/**
+ * @tparam Accuracy Maximum error.
+ * @tparam V Deduced simd type of `float` or `double`.
+ * @param x Argument.
+ * @return `e^x` for every lane.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, math_simd V>
+inline V exp(const V& x)
+{
+  if constexpr (!std::is_same_v<V, math_deduced_simd<V>>)
+  {
+    return stdx::static_simd_cast<V>(exp<Accuracy>(stdx::static_simd_cast<math_deduced_simd<V>>(x)));
+  }
+  else
+  {
+    return math_exp<Accuracy>(x, V(0));
+  }
+}
+
+/// Vectorized natural logarithm. Overloaded for scalar values.
+/**
+ * @tparam Accuracy Maximum error.
+ * @tparam V Deduced simd type of `float` or `double`.
+ * @param x Argument.
+ * @return `log(x)` for every lane. Negative arguments yield NaN, zero yields negative infinity.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, math_simd V>
+inline V log(const V& x)
+{
+  using T = typename V::value_type;
+  if constexpr (!std::is_same_v<V, math_deduced_simd<V>>)
+  {
+    return stdx::static_simd_cast<V>(log<Accuracy>(stdx::static_simd_cast<math_deduced_simd<V>>(x)));
+  }
+  else
+  {
+    V result = math_log<Accuracy>(x);
+    stdx::where(x == std::numeric_limits<T>::infinity(), result) = x;
+    stdx::where(x == T(0), result) = -std::numeric_limits<T>::infinity();
+    stdx::where(x < T(0) || x != x, result) = std::numeric_limits<T>::quiet_NaN();
+    return result;
+  }
+}
+
+/// Vectorized power function. Overloaded for scalar values.
+/**
+ * `log(x)` is computed with extra precision, so that the error of `y * log(x)` doesn't grow with the magnitude of the
+ * product. The special cases follow `std::pow`.
+ * @tparam Accuracy Maximum error.
+ * @tparam V Deduced simd type of `float` or `double`.
+ * @param x Base.
+ * @param y Exponent.
+ * @return `x^y` for every lane.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, math_simd V>
+inline V pow(const V& x, const V& y)
+{
+  using T = typename V::value_type;
+  if constexpr (!std::is_same_v<V, math_deduced_simd<V>>)
+  {
+    using DeducedType = math_deduced_simd<V>;
+    return stdx::static_simd_cast<V>(pow<Accuracy>(stdx::static_simd_cast<DeducedType>(x),
+      stdx::static_simd_cast<DeducedType>(y)));
+  }
+  else
+  {
+    constexpr T infinity = std::numeric_limits<T>::infinity();
+    V ax = stdx::abs(x);
+    V logLow;
+    V logHigh = math_log<math_accuracy::ulp1>(ax, &logLow);
+    stdx::where(ax == infinity, logHigh) = infinity;
+    stdx::where(ax == T(0), logHigh) = -infinity;
+    V product, productLow;
+    math_two_product(y, logHigh, product, productLow);
+    V result = math_exp<Accuracy>(product, productLow + y * logLow);
+
+    auto isInteger = stdx::floor(y) == y;
+    auto isOdd = isInteger && stdx::floor(y * T(0.5)) * T(2) != y;
+    stdx::where(stdx::signbit(x) && isOdd, result) = -result;
+    stdx::where(x < T(0) && ax != infinity && !isInteger, result) = std::numeric_limits<T>::quiet_NaN();
+    stdx::where(x != x || y != y, result) = x + y;
+    stdx::where(y == T(0) || x == T(1) || (ax == T(1) && stdx::abs(y) == infinity), result) = T(1);
+    return result;
+  }
+}
+
+/// Vectorized power function with a scalar exponent. Overloaded for scalar values.
+/**
+ * @tparam Accuracy Maximum error.
+ * @tparam V Deduced simd type of `float` or `double`.
+ * @param x Base.
+ * @param y Exponent.
+ * @return `x^y` for every lane.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, math_simd V>
+inline V pow(const V& x, typename V::value_type y)
+{
+  return pow<Accuracy>(x, V(y));
+}
+
+/// Vectorized error function. Overloaded for scalar values.
+/**
+ * The tail `|x| >= 1` is computed as `1 - exp(-x^2) * R(x)` and only evaluated, if any lane needs it.
+ * @tparam Accuracy Maximum error.
+ * @tparam V Deduced simd type of `float` or `double`.
+ * @param x Argument.
+ * @return `erf(x)` for every lane.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, math_simd V>
+inline V erf(const V& x)
+{
+  using T = typename V::value_type;
+  if constexpr (!std::is_same_v<V, math_deduced_simd<V>>)
+  {
+    return stdx::static_simd_cast<V>(erf<Accuracy>(stdx::static_simd_cast<math_deduced_simd<V>>(x)));
+  }
+  else if constexpr (std::is_same_v<T, float>)
+  {
+    using DoubleType = stdx::rebind_simd_t<double, V>;
+    return stdx::static_simd_cast<V>(erf<math_accuracy::ulp4>(stdx::static_simd_cast<DoubleType>(x)));
+  }
+  else
+  {
+    constexpr bool ulp1 = Accuracy == math_accuracy::ulp1;
+    // erf(x) = x + x * Q(x^2) for |x| < 1
+    V result;
+    if constexpr (ulp1)
+    {
+      // x^2 is computed with extra precision, its rounding error would contribute up to 0.5 ULP
+      V square, squareLow;
+      math_two_product(x, x, square, squareLow);
+      constexpr std::array coefficients{ 0.1283791670955126, -0.37612638903183754, 0.1128379167095512,
+        -0.02686617064512984, 0.0052239776254232985, -0.000854832702193483, 0.00012055332902888736,
+        -1.4925647567519332e-05, 1.6462045441468418e-06, -1.6364642158167616e-07, 1.4792401209404813e-08,
+        -1.216456005728345e-09, 8.709045129053106e-11, -4.230945824295338e-12 };
+      V q = math_polynomial<Accuracy>(square, coefficients) +
+        squareLow * (coefficients[1] + 2.0 * coefficients[2] * square);
+      result = math_fused_multiply_add(x, q, x);
+    }
+    else
+    {
+      result = x + x * math_polynomial(x * x, std::array{ 0.12837916709551256, -0.37612638903183543,
+        0.11283791670945006, -0.02686617064323777, 0.0052239776071164225, -0.0008548325975389692,
+        0.00012055294904839707, -1.492473690741966e-05, 1.6447424703317362e-06, -1.6208483801871705e-07,
+        1.3720064546777686e-08, -7.795898827002142e-10 });
+    }
+    V ax = stdx::abs(x);
+    auto tail = ax >= 1.0;
+    if (stdx::any_of(tail))
+    {
+      V square = ax * ax, squareLow(0.0);
+      if constexpr (ulp1)
+      {
+        math_two_product(ax, ax, square, squareLow);
+      }
+      V factor(0.0);
+      auto near = ax < 2.0;
+      if (stdx::any_of(tail && near))
+      {
+        // R(x) = erfc(x) * exp(x^2) for 1 <= x < 2
+        if constexpr (ulp1)
+        {
+          factor = math_polynomial(ax - 1.5, std::array{ 0.3215854164543175, -0.16362291773256007,
+            0.07615103985548055, -0.03293090529956347, 0.013377340952802835, -0.005145957547915988,
+            0.0018861348854630824, -0.0006619300686179933, 0.00022330981211640024, -7.265888759557882e-05,
+            2.286543658874603e-05, -6.975285854904505e-06, 2.061689065129881e-06, -5.946998373950516e-07,
+            1.8038197652346406e-07, -4.932844202000261e-08 });
+        }
+        else
+        {
+          factor = math_polynomial(ax - 1.5, std::array{ 0.3215854164543175, -0.16362291773256282,
+            0.07615103985547814, -0.03293090529915301, 0.013377340952957192, -0.00514595756566068,
+            0.0018861348817560994, -0.0006619297304232824, 0.00022330985450405092, -7.266219599461766e-05,
+            2.2865187808212496e-05, -6.957954859174092e-06, 2.06241304824337e-06, -6.409316664251228e-07,
+            1.7955431767928597e-07 });
+        }
+      }
+      if (stdx::any_of(tail && !near))
+      {
+        // R(x) = Q(1 / x) / x for 2 <= x < 6, erf(x) rounds to 1 for larger x
+        V u = 1.0 / ax;
+        V farFactor;
+        if constexpr (ulp1)
+        {
+          farFactor = u * math_polynomial(u - 1.0 / 3.0, std::array{ 0.5370034535441699, -0.14295934043888917,
+            -0.11537284741577758, 0.19568021014222126, -0.10262206219618186, -0.09665769860624768,
+            0.27599996025051676, -0.28476639855266395, 0.018882337665071504, 0.48273282434399056,
+            -0.9580727471477329, 0.9389606992789234, 0.16986315920845121, -2.930351956342593, 4.913061572406633 });
+        }
+        else
+        {
+          farFactor = u * math_polynomial(u - 1.0 / 3.0, std::array{ 0.5370034535441699, -0.14295934043464986,
+            -0.11537284742296984, 0.1956802058592061, -0.10262205495426197, -0.09665646301600357,
+            0.2759978763464988, -0.2849191031484622, 0.01913937647882552, 0.49190449089426036,
+            -0.973486532915096, 0.6745970262219146, 0.6135758078156909 });
+        }
+        stdx::where(!near, factor) = farFactor;
+      }
+      V tailResult = 1.0 - math_exp<Accuracy>(-square, -squareLow) * factor;
+      stdx::where(ax >= 6.0, tailResult) = 1.0;
+      stdx::where(x < 0.0, tailResult) = -tailResult;
+      stdx::where(tail, result) = tailResult;
+    }
+    return result;
+  }
+}
+
+/// Exponential function of a scalar value. Overloaded for simd values.
+/**
+ * @tparam Accuracy Unused, `std::exp` is called.
+ * @tparam T Deduced floating point type.
+ * @param x Argument.
+ * @return `std::exp(x)`.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, std::floating_point T>
+inline T exp(T x)
+{
+  return std::exp(x);
+}
+
+/// Natural logarithm of a scalar value. Overloaded for simd values.
+/**
+ * @tparam Accuracy Unused, `std::log` is called.
+ * @tparam T Deduced floating point type.
+ * @param x Argument.
+ * @return `std::log(x)`.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, std::floating_point T>
+inline T log(T x)
+{
+  return std::log(x);
+}
+
+/// Power function of scalar values. Overloaded for simd values.
+/**
+ * @tparam Accuracy Unused, `std::pow` is called.
+ * @tparam T Deduced floating point type.
+ * @param x Base.
+ * @param y Exponent.
+ * @return `std::pow(x, y)`.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, std::floating_point T>
+inline T pow(T x, std::type_identity_t<T> y)
+{
+  return std::pow(x, y);
+}
+
+/// Error function of a scalar value. Overloaded for simd values.
+/**
+ * @tparam Accuracy Unused, `std::erf` is called.
+ * @tparam T Deduced floating point type.
+ * @param x Argument.
+ * @return `std::erf(x)`.
+ */
+template<math_accuracy Accuracy = math_accuracy::ulp1, std::floating_point T>
+inline T erf(T x)
+{
+  return std::erf(x);
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_MATH
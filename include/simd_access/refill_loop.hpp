@@ -0,0 +1,139 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Loop for iterative per-element work with a varying number of iterations.
+ */
+
+#ifndef SIMD_ACCESS_REFILL_LOOP
+#define SIMD_ACCESS_REFILL_LOOP
+
+#include <concepts>
+#include <cstddef>
+#include <experimental/bits/simd.h>
+#include <type_traits>
+
+#include "simd_access/base.hpp"
+#include "simd_access/load_store.hpp"
+#include "simd_access/reflection.hpp"
+
+namespace simd_access
+{
+
+/// Counts the work of a \ref refill_loop.
+struct refill_statistics
+{
+  /// Number of vectorized iteration steps.
+  size_t steps = 0;
+  /// Number of lanes, which processed an element, summed up over all steps.
+  size_t active_lanes = 0;
+  /// Vector size of the loop.
+  size_t simd_size = 0;
+
+  /// Returns the fraction of lanes, which did useful work.
+  double utilization() const { return steps == 0 ? 1.0 : double(active_lanes) / double(steps * simd_size); }
+};
+
+/**
+ * Simd-ized iteration over elements, which require a different number of iterative steps each (e.g. Newton
+ * solves). A vector of elements is stepped, and the lanes, which finished, become inactive. Their results are kept in
+ * a result vector. As soon as at most `RefillThreshold` lanes are active, the results are stored, and the inactive
+ * lanes are refilled with the next elements of the range, whose state is loaded into them. Thus the lanes don't idle
+ * until the slowest element of a vector finished, as they do in a \ref loop with a `while (any_of(...))` body. The
+ * loop pays off, if the number of steps varies strongly between the elements (e.g. a few stiff elements, which need
+ * many more steps than the others), and if a step costs more than the refill (a gather of the state and a scatter of
+ * the results). A high threshold refills often and keeps the utilization high, a low threshold amortizes a refill over
+ * more lanes.
+ * ~~~{.cpp}
+ * sa::refill_loop<vec_size>(0, n,
+ *   [&](const auto& i) { return SIMD_ACCESS(cells, i).to_simd(); },
+ *   [&](auto& state) { return newton_step(state); },
+ *   [&](const auto& i, const auto& state, const auto& mask) { sa::where(mask, SIMD_ACCESS(cells, i)) = state; });
+ * ~~~
+ * @tparam SimdSize Vector size.
+ * @tparam RefillThreshold Maximal number of active lanes, at which the inactive lanes are refilled. Must be in the
+ *   range [0, SimdSize).
+ * @tparam IndexType Deduced type of the indices.
+ * @param start Inclusive start of the range of indices.
+ * @param end Exclusive end of the range of indices.
+ * @param load Function taking an index vector of type `stdx::fixed_size_simd<IndexType, SimdSize>` and returning
+ *   the simd state (a `stdx::simd` or a structure-of-simd) of the indexed elements.
+ * @param step Function performing one iterative step on the simd state (passed as non-const reference). Returns
+ *   a `stdx::simd_mask`, which marks the finished lanes. Inactive lanes are stepped too, but their results are
+ *   ignored.
+ * @param store Function taking the index vector, the simd state and a mask of the same type as returned by `step`.
+ *   It must store the results of the lanes selected by the mask. It is called once per refill, not per step.
+ * @return Statistics of the lane utilization.
+ */
+template<int SimdSize, int RefillThreshold = SimdSize / 2, std::integral IndexType>
+  requires (RefillThreshold >= 0 && RefillThreshold < SimdSize)
+inline refill_statistics refill_loop(IndexType start, IndexType end, auto&& load, auto&& step, auto&& store)
+{
+  using SimdIndexType = stdx::fixed_size_simd<IndexType, SimdSize>;
+  refill_statistics statistics;
+  statistics.simd_size = SimdSize;
+  if (start >= end)
+  {
+    return statistics;
+  }
+  IndexType next = start;
+  // inactive lanes keep an index inside the range, so that their loads stay valid
+  SimdIndexType idx(start);
+  auto state = load(idx);
+  using MaskType = std::remove_cvref_t<decltype(step(state))>;
+  MaskType active(false), pending(false);
+  int activeCount = 0;
+  // results of finished lanes are collected and stored together with the next refill
+  auto result = state;
+  auto select = [](auto& dest, const auto& src, const MaskType& mask)
+    {
+      simd_members([&](auto&& d, auto&& s)
+        {
+          where(simd_mask_for<typename std::remove_cvref_t<decltype(d)>::value_type, SimdSize>(mask), d) = s;
+        }, dest, src);
+    };
+  auto refill = [&]()
+    {
+      auto refilled = !active;
+      for (int i = 0; i < SimdSize; ++i)
+      {
+        if (refilled[i])
+        {
+          if (next < end)
+          {
+            idx[i] = next++;
+          }
+          else
+          {
+            refilled[i] = false;
+          }
+        }
+      }
+      active = active || refilled;
+      activeCount = stdx::popcount(active);
+      select(state, load(idx), refilled);
+    };
+  refill();
+  while (activeCount > 0)
+  {
+    auto finished = step(state) && active;
+    ++statistics.steps;
+    statistics.active_lanes += activeCount;
+    select(result, state, finished);
+    pending = pending || finished;
+    active = active && !finished;
+    activeCount = stdx::popcount(active);
+    // a refill costs a gather, so it waits until enough lanes are inactive
+    if (activeCount <= RefillThreshold && (next < end || activeCount == 0))
+    {
+      store(idx, result, pending);
+      pending = MaskType(false);
+      refill();
+    }
+  }
+  return statistics;
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_REFILL_LOOP
@@ -10,15 +10,25 @@
  *   variable of the same type.
  * 2. `simd_members` takes a pack of scalar or simdized variables and iterates over all simdized members
  *   calling a functor.
+ *
+ * Both functions are provided automatically for aggregates (see aggregate.hpp) as well as for `std::array`, C arrays,
+ * `std::pair`, `std::tuple` and `std::vector`. User-written functions take precedence over the automatic ones.
  */
 
 #ifndef SIMD_REFLECTION
 #define SIMD_REFLECTION
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "simd_access/aggregate.hpp"
 #include "simd_access/base.hpp"
+#include "simd_access/inline_vector.hpp"
 #include "simd_access/location.hpp"
 #include "simd_access/index.hpp"
 
@@ -59,16 +69,38 @@ inline auto simdized_value(T)
   return stdx::fixed_size_simd<T, SimdSize>();
 }
 
+// Pointers are simdized to universal simds of pointers, e.g. for the traversal of linked structures.
+template<int SimdSize, class T>
+inline auto simdized_value(T*)
+{
+  return universal_simd<T*, SimdSize>();
+}
+
+template<class FN, class T, int SimdSize>
+inline void simd_members(FN&& func, universal_simd<T*, SimdSize>& d, T* s)
+{
+  func(d, s);
+}
+
+template<class FN, class T, int SimdSize>
+inline void simd_members(FN&& func, T*& d, const universal_simd<T*, SimdSize>& s)
+{
+  func(d, s);
+}
+
 // overloads for std types, which can't be added after the template definition, since ADL wouldn't found it
+// The simdized type of a std::vector stores its elements inline to avoid a heap allocation for every simd index.
 template<int SimdSize, class T>
 inline auto simdized_value(const std::vector<T>& v)
 {
-  std::vector<decltype(simdized_value<SimdSize>(std::declval<T>()))> result(v.size());
-  return result;
+  using ValueType = decltype(simdized_value<SimdSize>(std::declval<T>()));
+  return inline_vector<ValueType, simdized_vector_capacity<T>::value>(v.size());
 }
 
+template<class T>
+concept simdizable_vector = specialization_of<T, std::vector> || inline_vector_type<T>;
 
-template<simd_access::specialization_of<std::vector>... Args>
+template<simdizable_vector... Args>
 inline void simd_members(auto&& func, Args&&... values)
 {
   auto&& d = std::get<0>(std::forward_as_tuple(std::forward<Args>(values)...));
@@ -90,8 +122,332 @@ inline void simd_members(auto&& func, Args&&... values)
   simd_members(func, values.first ...);
   simd_members(func, values.second ...);
 }
+
+// Arrays and tuples are simdized element-wise. The elements are unrolled at compile time.
+template<class T>
+concept std_array =
+  requires(std::remove_cvref_t<T> x) { []<class U, size_t Size>(std::array<U, Size>&){}(x); };
+
+template<class T>
+concept simdizable_array = std_array<T> || std::is_bounded_array_v<std::remove_cvref_t<T>>;
+
+template<simdizable_array T>
+constexpr size_t array_extent = []
+  {
+    if constexpr (std::is_array_v<std::remove_cvref_t<T>>)
+    {
+      return std::extent_v<std::remove_cvref_t<T>>;
+    }
+    else
+    {
+      return std::tuple_size_v<std::remove_cvref_t<T>>;
+    }
+  }();
+
+template<int SimdSize, simdizable_array T>
+inline auto simdized_value(const T& v)
+{
+  return [&]<size_t... I>(std::index_sequence<I...>)
+    {
+      using ValueType = decltype(simdized_value<SimdSize>(v[0]));
+      return std::array<ValueType, sizeof...(I)>{ simdized_value<SimdSize>(v[I]) ... };
+    }(std::make_index_sequence<array_extent<T>>());
+}
+
+template<simdizable_array... Args>
+inline void simd_members(auto&& func, Args&&... values)
+{
+  auto member = [&](auto i)
+    {
+      simd_members(func, values[decltype(i)::value] ...);
+    };
+  [&]<size_t... I>(std::index_sequence<I...>)
+    {
+      (member(std::integral_constant<size_t, I>()), ...);
+    }(std::make_index_sequence<std::min({ array_extent<Args>... })>());
+}
+
+template<int SimdSize, class... T>
+inline auto simdized_value(const std::tuple<T...>& v)
+{
+  return std::apply([](const auto&... elements)
+    {
+      return std::make_tuple(simdized_value<SimdSize>(elements) ...);
+    }, v);
+}
+
+template<simd_access::specialization_of<std::tuple>... Args>
+inline void simd_members(auto&& func, Args&&... values)
+{
+  auto member = [&](auto i)
+    {
+      simd_members(func, std::get<decltype(i)::value>(values) ...);
+    };
+  [&]<size_t... I>(std::index_sequence<I...>)
+    {
+      (member(std::integral_constant<size_t, I>()), ...);
+    }(std::make_index_sequence<std::min({ std::tuple_size_v<std::remove_cvref_t<Args>>... })>());
+}
+
+// Aggregates without user-written hooks are reflected automatically (see aggregate.hpp). The simdized type of
+// `Tmpl<Args...>` is `Tmpl<simdized Args...>`, if its members are the simdized members. Otherwise it's a std::tuple.
+template<int SimdSize, reflectable_aggregate T>
+inline auto simdized_value(const T& v);
+
+template<class T, int SimdSize>
+struct simdized_template
+{
+  using type = void;
+};
+
+template<template<class...> class Tmpl, class... Args, int SimdSize>
+  requires (requires { simdized_value<SimdSize>(std::declval<Args>()); } && ...)
+struct simdized_template<Tmpl<Args...>, SimdSize>
+{
+  using type = Tmpl<decltype(simdized_value<SimdSize>(std::declval<Args>()))...>;
+};
+
+// C arrays of simd types are accepted as simdized C arrays, too.
+template<class SimdizedType, class T, int SimdSize>
+constexpr bool is_simdized_member = []
+  {
+    if constexpr (std::is_array_v<SimdizedType> && std::is_array_v<T>)
+    {
+      return std::extent_v<SimdizedType> == std::extent_v<T> &&
+        is_simdized_member<std::remove_extent_t<SimdizedType>, std::remove_extent_t<T>, SimdSize>;
+    }
+    else
+    {
+      return std::is_same_v<SimdizedType, decltype(simdized_value<SimdSize>(std::declval<T>()))>;
+    }
+  }();
+
+template<class SimdizedType, class T, int SimdSize>
+constexpr bool is_simdized_aggregate = []
+  {
+    if constexpr (std::is_aggregate_v<SimdizedType> && std::is_default_constructible_v<SimdizedType>)
+    {
+      using Members = decltype(tie_members<SimdizedType, aggregate_arity<T>>(std::declval<SimdizedType&>()));
+      return []<class... D, class... S>(std::tuple<D...>*, std::tuple<S...>*)
+        {
+          return (is_simdized_member<std::remove_reference_t<D>, S, SimdSize> && ...);
+        }(static_cast<Members*>(nullptr), static_cast<aggregate_member_types<T>*>(nullptr));
+    }
+    return false;
+  }();
+
+template<int SimdSize>
+inline void assign_simdized(auto& dest, const auto& scalar)
+{
+  if constexpr (std::is_array_v<std::remove_reference_t<decltype(dest)>>)
+  {
+    for (size_t i = 0; i < std::extent_v<std::remove_reference_t<decltype(dest)>>; ++i)
+    {
+      assign_simdized<SimdSize>(dest[i], scalar[i]);
+    }
+  }
+  else
+  {
+    dest = simdized_value<SimdSize>(scalar);
+  }
+}
+
+template<int SimdSize, reflectable_aggregate T>
+inline auto simdized_value(const T& v)
+{
+  using SimdizedType = typename simdized_template<T, SimdSize>::type;
+  if constexpr (is_simdized_aggregate<SimdizedType, T, SimdSize>)
+  {
+    SimdizedType result{};
+    auto dest = tie_members<SimdizedType, aggregate_arity<T>>(result);
+    auto src = tie_members(v);
+    [&]<size_t... I>(std::index_sequence<I...>)
+      {
+        (assign_simdized<SimdSize>(std::get<I>(dest), std::get<I>(src)), ...);
+      }(std::make_index_sequence<aggregate_arity<T>>());
+    return result;
+  }
+  else
+  {
+    return std::apply([](const auto&... members)
+      {
+        return std::make_tuple(simdized_value<SimdSize>(members) ...);
+      }, tie_members(v));
+  }
+}
+
+template<class FN, class... Args>
+constexpr bool reflects_aggregates = (reflectable_aggregate<Args> || ...) &&
+  ((reflectable_aggregate<Args> || specialization_of<Args, std::tuple>) && ...);
+
+// The functor is part of the parameter pack, so that user-written hooks `simd_members(func, values...)` are more
+// specialized and thus preferred.
+template<class... Args>
+  requires reflects_aggregates<Args...>
+inline void simd_members(Args&&... all)
+{
+  [](auto&& func, auto&... values)
+    {
+      // The arity of simdized aggregates may be undercounted (see aggregate_arity), but never overcounted.
+      constexpr size_t arity = std::max({ size_t(0), [&]
+        {
+          if constexpr (reflectable_aggregate<decltype(values)>)
+          {
+            return aggregate_arity<decltype(values)>;
+          }
+          return size_t(0);
+        }() ... });
+      auto tie = [](auto& value)
+        {
+          if constexpr (reflectable_aggregate<decltype(value)>)
+          {
+            return tie_members<std::remove_reference_t<decltype(value)>, arity>(value);
+          }
+          else
+          {
+            return std::apply([](auto&... elements) { return std::tie(elements...); }, value);
+          }
+        };
+      [&]<size_t... I>(std::index_sequence<I...>, auto... members)
+        {
+          auto member = [&](auto i)
+            {
+              simd_members(func, std::get<decltype(i)::value>(members) ...);
+            };
+          (member(std::integral_constant<size_t, I>()), ...);
+        }(std::make_index_sequence<arity>(), tie(values) ...);
+    }(all...);
+}
 ///@endcond
 
+/// Describes, whether the scalar values of a type are stored densely, i.e. without padding and of the same type.
+/**
+ * Dense types are arithmetic types and arrays and padding-free aggregates of dense types with the same value type.
+ * The scalar values of `SimdSize` objects of a dense type can be loaded with contiguous vector loads and transposed
+ * in registers instead of gathered member by member.
+ * @tparam T Type.
+ */
+template<class T>
+struct dense_layout : std::false_type {};
+
+/// Specialization of \ref dense_layout for arithmetic types.
+/**
+ * @tparam T Arithmetic type.
+ */
+template<simd_arithmetic T>
+struct dense_layout<T> : std::true_type
+{
+  /// Type of the scalar values.
+  using value_type = std::remove_cvref_t<T>;
+  /// Number of scalar values.
+  static constexpr size_t count = 1;
+};
+
+/// Specialization of \ref dense_layout for arrays of dense types.
+/**
+ * @tparam T Array type.
+ */
+template<simdizable_array T>
+  requires dense_layout<std::remove_cvref_t<decltype(std::declval<T&>()[0])>>::value
+struct dense_layout<T> : std::true_type
+{
+  /// Layout of the elements.
+  using element_layout = dense_layout<std::remove_cvref_t<decltype(std::declval<T&>()[0])>>;
+  /// Type of the scalar values.
+  using value_type = typename element_layout::value_type;
+  /// Number of scalar values.
+  static constexpr size_t count = array_extent<T> * element_layout::count;
+};
+
+///@cond
+template<class Tuple>
+constexpr bool dense_members = false;
+
+template<class First, class... Members>
+  requires (dense_layout<First>::value && ... && dense_layout<Members>::value)
+constexpr bool dense_members<std::tuple<First, Members...>> =
+  (std::is_same_v<typename dense_layout<First>::value_type, typename dense_layout<Members>::value_type> && ...);
+///@endcond
+
+/// Specialization of \ref dense_layout for aggregates of dense types.
+/**
+ * @tparam T Aggregate type.
+ */
+template<reflectable_aggregate T>
+  requires (aggregate_without_padding<T> && dense_members<aggregate_member_types<T>>)
+struct dense_layout<T> : std::true_type
+{
+  /// Type of the scalar values.
+  using value_type = typename dense_layout<std::tuple_element_t<0, aggregate_member_types<T>>>::value_type;
+  /// Number of scalar values.
+  static constexpr size_t count = sizeof(T) / sizeof(value_type);
+};
+
+/**
+ * Creates a structure-of-simd value from the scalar values of all vector lanes. The simdized value is created from
+ * the value of lane 0, so that members with a run-time size (e.g. `std::vector`) get the right size.
+ * @tparam ScalarType Type of the scalar values.
+ * @tparam SimdSize Vector size of the simd type.
+ * @param visit_lane Functor called with a vector lane `i` and a functor `assign`. It must call `assign` with the scalar
+ *   value of lane `i`. Thus, the scalar value may be a temporary.
+ * @return A simd value.
+ */
+template<class ScalarType, int SimdSize>
+inline auto simdized_from_lanes(auto&& visit_lane)
+{
+  decltype(simdized_value<SimdSize>(std::declval<ScalarType>())) result;
+  for (int i = 0; i < SimdSize; ++i)
+  {
+    visit_lane(i, [&](const auto& scalar)
+      {
+        if (i == 0)
+        {
+          result = simdized_value<SimdSize>(scalar);
+        }
+        simd_members([&](auto&& dest, auto&& src)
+          {
+            dest[i] = src;
+          },
+          result, scalar);
+      });
+  }
+  return result;
+}
+
+/**
+ * Checks, whether all members of a structure are stored inside the structure itself. This isn't the case for the
+ * elements of a `std::vector` member. Only if the check succeeds, the members of the structures in a simd location
+ * can be accessed with a constant pitch. Trivially copyable structures can't have indirect members, so the check
+ * is skipped for them. Pointers are simdized to universal simds, which are always accessed lane by lane.
+ * @tparam T Deduced type of the scalar structure.
+ * @param value Scalar structure.
+ * @return True, if the addresses of all members are in the range `[&value, &value + 1)`.
+ */
+template<class T>
+inline bool members_inside(const T& value)
+{
+  if constexpr (std::is_pointer_v<T>)
+  {
+    return false;
+  }
+  else if constexpr (std::is_trivially_copyable_v<T>)
+  {
+    return true;
+  }
+  else
+  {
+    bool result = true;
+    auto begin = reinterpret_cast<uintptr_t>(&value);
+    simd_members([&](const auto& member)
+      {
+        // unsigned arithmetic: addresses below begin result in large offsets
+        auto offset = reinterpret_cast<uintptr_t>(&member) - begin;
+        result = result && offset < sizeof(T);
+      }, value);
+    return result;
+  }
+}
+
 /**
  * Loads a structure-of-simd value from a memory location defined by a base address and an linear index. The simd
  * elements to be loaded are located at the positions base, base+ElementSize, base+2*ElementSize, ...
@@ -107,11 +463,18 @@ template<size_t ElementSize, class T, int SimdSize>
 inline auto load(const linear_location<T, SimdSize>& location)
 {
   auto result = simdized_value<SimdSize>(*location.base_);
-  simd_members([&](auto&& dest, auto&& src)
-    {
-      dest = load<ElementSize>(linear_location<std::remove_reference_t<decltype(src)>, SimdSize>{&src});
-    },
-    result, *location.base_);
+  if (members_inside(*location.base_))
+  {
+    simd_members([&](auto&& dest, auto&& src)
+      {
+        dest = load<ElementSize>(linear_location<std::remove_reference_t<decltype(src)>, SimdSize>{&src});
+      },
+      result, *location.base_);
+  }
+  else
+  {
+    result = load_lanes<ElementSize, SimdSize>(location);
+  }
   return result;
 }
 
@@ -130,16 +493,10 @@ template<class BaseType, simd_index IndexType>
   requires (!simd_arithmetic<BaseType>)
 inline auto load_rvalue(auto&& base, const IndexType& idx, auto&& subobject)
 {
-  decltype(simdized_value<IndexType::size()>(std::declval<BaseType>())) result;
-  for (decltype(idx.size()) i = 0, e = idx.size(); i < e; ++i)
-  {
-    simd_members([&](auto&& dest, auto&& src)
-      {
-        dest[i] = src;
-      },
-      result, subobject(base[scalar_index(idx, i)]));
-  }
-  return result;
+  return simdized_from_lanes<BaseType, IndexType::size()>([&](auto i, auto&& assign)
+    {
+      assign(subobject(base[scalar_index(idx, i)]));
+    });
 }
 
 /**
@@ -155,16 +512,88 @@ template<class BaseType, simd_index IndexType>
   requires (!simd_arithmetic<BaseType>)
 inline auto load_rvalue(auto&& base, const IndexType& idx)
 {
-  decltype(simdized_value<IndexType::size()>(std::declval<BaseType>())) result;
-  for (decltype(idx.size()) i = 0, e = idx.size(); i < e; ++i)
+  return simdized_from_lanes<BaseType, IndexType::size()>([&](auto i, auto&& assign)
+    {
+      assign(base[scalar_index(idx, i)]);
+    });
+}
+
+/**
+ * Loads a structure-of-simd value lane by lane from the elements of a simd location. This is the fallback for
+ * structures, whose members can't be accessed with a constant pitch (see \ref members_inside).
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam SimdSize Vector size of the simd type.
+ * @param location Simd location (see \ref linear_location, \ref strided_location and \ref indexed_location).
+ * @return A simd value.
+ */
+template<size_t ElementSize, int SimdSize>
+inline auto load_lanes(const auto& location)
+{
+  using T = typename std::remove_cvref_t<decltype(location)>::value_type;
+  return simdized_from_lanes<std::remove_const_t<T>, SimdSize>([&](int i, auto&& assign)
+    {
+      assign(location.template lane<ElementSize>(i));
+    });
+}
+
+/**
+ * Stores a structure-of-simd value lane by lane to the elements of a simd location. This is the fallback for
+ * structures, whose members can't be accessed with a constant pitch (see \ref members_inside).
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam SimdSize Vector size of the simd type.
+ * @param location Simd location (see \ref linear_location, \ref strided_location and \ref indexed_location).
+ * @param source Structure-of-simd value.
+ */
+template<size_t ElementSize, int SimdSize>
+inline void store_lanes(const auto& location, const auto& source)
+{
+  for (int i = 0; i < SimdSize; ++i)
   {
     simd_members([&](auto&& dest, auto&& src)
       {
-        dest[i] = src;
+        dest = src[i];
       },
-      result, base[scalar_index(idx, i)]);
+      location.template lane<ElementSize>(i), source);
+  }
+}
+
+/**
+ * Stores a structure-of-simd value of a dense type (see \ref dense_layout) row by row: The scalar values of every
+ * vector lane are transposed into one vector, which is stored with a single contiguous store. The lane addresses are
+ * computed once for all members. Falls back to \ref store_lanes, if `simd_members` doesn't enumerate every scalar
+ * value of the structure.
+ * There is no row-wise counterpart for loads: Row loads followed by a transposition in registers were measured slower
+ * than the per-member gathers, which share the lane offsets.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam SimdSize Vector size of the simd type.
+ * @param location Simd location (see \ref linear_location, \ref strided_location and \ref indexed_location).
+ * @param source Structure-of-simd value.
+ */
+template<size_t ElementSize, int SimdSize>
+inline void store_rows(const auto& location, const auto& source)
+{
+  using T = typename std::remove_cvref_t<decltype(location)>::value_type;
+  using ValueType = typename dense_layout<T>::value_type;
+  constexpr auto count = dense_layout<T>::count;
+  // sort the simd members by the offsets of their scalar counterparts
+  std::array<const stdx::fixed_size_simd<ValueType, SimdSize>*, count> columns{};
+  simd_members([&](const auto& scalar, const auto& column)
+    {
+      auto offset = reinterpret_cast<const char*>(&scalar) - reinterpret_cast<const char*>(location.base_);
+      assert(offset >= 0 && size_t(offset) < sizeof(T));
+      columns[offset / sizeof(ValueType)] = &column;
+    }, *location.base_, source);
+  // members, which are skipped by simd_members, leave their columns empty
+  if (std::find(columns.begin(), columns.end(), nullptr) != columns.end())
+  {
+    store_lanes<ElementSize, SimdSize>(location, source);
+    return;
+  }
+  for (int i = 0; i < SimdSize; ++i)
+  {
+    stdx::fixed_size_simd<ValueType, count> row([&](auto j) { return (*columns[j])[i]; });
+    row.copy_to(reinterpret_cast<ValueType*>(&location.template lane<ElementSize>(i)), stdx::element_aligned);
   }
-  return result;
 }
 
 /**
@@ -183,6 +612,16 @@ template<size_t ElementSize, class T, class ExprType, int SimdSize>
 inline void store(const linear_location<T, SimdSize>& location, const ExprType& expr)
 {
   const decltype(simdized_value<SimdSize>(std::declval<T>()))& source = expr;
+  if constexpr (dense_layout<T>::value)
+  {
+    store_rows<ElementSize, SimdSize>(location, source);
+    return;
+  }
+  if (!members_inside(*location.base_))
+  {
+    store_lanes<ElementSize, SimdSize>(location, source);
+    return;
+  }
   simd_members([&](auto&& dest, auto&& src)
     {
       store<ElementSize>(
@@ -207,12 +646,19 @@ template<size_t ElementSize, class T, int SimdSize, class IndexArray>
 inline auto load(const indexed_location<T, SimdSize, IndexArray>& location)
 {
   auto result = simdized_value<SimdSize>(*location.base_);
-  simd_members([&](auto&& dest, auto&& src)
-    {
-      dest = load<ElementSize>(indexed_location<std::remove_reference_t<decltype(src)>, SimdSize, IndexArray>{
-        &src, location.indices_});
-    },
-    result, *location.base_);
+  if (members_inside(*location.base_))
+  {
+    simd_members([&](auto&& dest, auto&& src)
+      {
+        dest = load<ElementSize>(indexed_location<std::remove_reference_t<decltype(src)>, SimdSize, IndexArray>{
+          &src, location.indices_});
+      },
+      result, *location.base_);
+  }
+  else
+  {
+    result = load_lanes<ElementSize, SimdSize>(location);
+  }
   return result;
 }
 
@@ -233,6 +679,16 @@ template<size_t ElementSize, class T, class ExprType, int SimdSize, class IndexA
 inline void store(const indexed_location<T, SimdSize, IndexArray>& location, const ExprType& expr)
 {
   const decltype(simdized_value<SimdSize>(std::declval<T>()))& source = expr;
+  if constexpr (dense_layout<T>::value)
+  {
+    store_rows<ElementSize, SimdSize>(location, source);
+    return;
+  }
+  if (!members_inside(*location.base_))
+  {
+    store_lanes<ElementSize, SimdSize>(location, source);
+    return;
+  }
   simd_members([&](auto&& dest, auto&& src)
     {
       using location_type = indexed_location<std::remove_reference_t<decltype(dest)>, SimdSize, IndexArray>;
@@ -240,6 +696,137 @@ inline void store(const indexed_location<T, SimdSize, IndexArray>& location, con
     }, *location.base_, source);
 }
 
+/**
+ * Loads a structure-of-simd value from a memory location defined by a base address and a strided index. The simd
+ * elements to be loaded are located at the positions base, base+stride*ElementSize, base+2*stride*ElementSize, ...
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of the scalar structure, of which `SimdSize` number of objects will be combined in a
+ *   structure-of-simd.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @param location Address of the first element and stride of the memory location.
+ * @return A simd value.
+ */
+template<size_t ElementSize, class T, int SimdSize>
+  requires (!simd_arithmetic<T>)
+inline auto load(const strided_location<T, SimdSize>& location)
+{
+  auto result = simdized_value<SimdSize>(*location.base_);
+  if (members_inside(*location.base_))
+  {
+    simd_members([&](auto&& dest, auto&& src)
+      {
+        dest = load<ElementSize>(location.subobject_access(src));
+      },
+      result, *location.base_);
+  }
+  else
+  {
+    result = load_lanes<ElementSize, SimdSize>(location);
+  }
+  return result;
+}
+
+/**
+ * Stores a structure-of-simd value to a memory location defined by a base address and a strided index. The simd
+ * elements are stored at the positions base, base+stride*ElementSize, base+2*stride*ElementSize, ...
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam T Deduced type of the scalar structure, of which `SimdSize`number of objects are combined in a
+ *   structure-of-simd.
+ * @tparam SimdSize Deduced vector size of the simd type.
+ * @tparam ExprType Deduced type of the source expression.
+ * @param location Address of the first element and stride of the memory location.
+ * @param expr The expression, whose result is stored. Must be convertible to a structure-of-simd.
+ */
+template<size_t ElementSize, class T, class ExprType, int SimdSize>
+  requires (!simd_arithmetic<T>)
+inline void store(const strided_location<T, SimdSize>& location, const ExprType& expr)
+{
+  const decltype(simdized_value<SimdSize>(std::declval<T>()))& source = expr;
+  if constexpr (dense_layout<T>::value)
+  {
+    store_rows<ElementSize, SimdSize>(location, source);
+    return;
+  }
+  if (!members_inside(*location.base_))
+  {
+    store_lanes<ElementSize, SimdSize>(location, source);
+    return;
+  }
+  simd_members([&](auto&& dest, auto&& src)
+    {
+      store<ElementSize>(location.subobject_access(dest), src);
+    }, *location.base_, source);
+}
+
+/**
+ * Stores the vector lanes of a structure-of-simd value, which are selected by a mask, to a simd location. The other
+ * elements are neither read nor written.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam LocationType Deduced type of the simd location.
+ * @param location Simd location (see \ref linear_location, \ref strided_location and \ref indexed_location).
+ * @param mask Simd mask selecting the stored lanes.
+ * @param expr The expression, whose result is stored. Must be convertible to a structure-of-simd.
+ */
+template<size_t ElementSize, class LocationType>
+  requires (!simd_arithmetic<typename LocationType::value_type>)
+inline void masked_store(const LocationType& location, const auto& mask, const auto& expr)
+{
+  using T = typename LocationType::value_type;
+  constexpr auto simdSize = LocationType::size();
+  const decltype(simdized_value<simdSize>(std::declval<T>()))& source = expr;
+  if (members_inside(*location.base_))
+  {
+    simd_members([&](auto& dest, const auto& src)
+      {
+        masked_store<ElementSize>(location.subobject_access(dest), mask, src);
+      }, *location.base_, source);
+  }
+  else
+  {
+    for (int i = 0; i < simdSize; ++i)
+    {
+      if (mask[i])
+      {
+        simd_members([&](auto&& dest, auto&& src) { dest = src[i]; }, location.template lane<ElementSize>(i), source);
+      }
+    }
+  }
+}
+
+/**
+ * Loads the vector lanes, which are selected by a mask, of a structure-of-simd value from a simd location. The other
+ * elements aren't read, their values are zero.
+ * @tparam ElementSize Size in bytes of the type of the simd-indexed element.
+ * @tparam LocationType Deduced type of the simd location.
+ * @param location Simd location (see \ref linear_location, \ref strided_location and \ref indexed_location).
+ * @param mask Simd mask selecting the loaded lanes.
+ * @return A simd value.
+ */
+template<size_t ElementSize, class LocationType>
+  requires (!simd_arithmetic<typename LocationType::value_type>)
+inline auto masked_load(const LocationType& location, const auto& mask)
+{
+  auto result = simdized_value<LocationType::size()>(*location.base_);
+  if (members_inside(*location.base_))
+  {
+    simd_members([&](auto& dest, const auto& src)
+      {
+        dest = masked_load<ElementSize>(location.subobject_access(src), mask);
+      }, result, *location.base_);
+  }
+  else
+  {
+    for (int i = 0; i < LocationType::size(); ++i)
+    {
+      if (mask[i])
+      {
+        simd_members([&](auto&& dest, auto&& src) { dest[i] = src; }, result, location.template lane<ElementSize>(i));
+      }
+    }
+  }
+  return result;
+}
+
 /**
  * Returns a `where_expression` for structure-of-simd types, which are unsupported by stdx::simd.
  * @tparam MASK Deduced type of the simd mask.
@@ -255,6 +842,20 @@ inline auto where(const M& mask, T& dest)
   return where_expression<M, T>(mask, dest);
 }
 
+/**
+ * Returns a `stdx::where_expression` for a scalar arithmetic value, so that `where` can be used uniformly for simd and
+ * scalar indices.
+ * @tparam T Deduced arithmetic type.
+ * @param mask The mask.
+ * @param dest Reference to the value, to which `mask` is applied.
+ * @return A `stdx::where_expression` combining `mask`and `dest`.
+ */
+template<simd_arithmetic T>
+inline auto where(bool mask, T& dest)
+{
+  return stdx::where(mask, dest);
+}
+
 /**
  * Extends `stdx::where_expression` for structure-of-simd types.
  * @tparam M Type of the simd mask.
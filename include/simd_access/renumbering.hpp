@@ -0,0 +1,386 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Permutations, which improve the index locality of indirect loops, and their application to fields.
+ *
+ * All orders are returned as `order[newIndex] == oldIndex`. \ref inverse_permutation yields the mapping from old to
+ * new indices, which is used by \ref renumber_nodes to update a connectivity.
+ * ~~~{.cpp}
+ * auto order = sa::reverse_cuthill_mckee(nodeCount, edges);
+ * sa::renumber_nodes(edges, sa::inverse_permutation(order));
+ * coordinates = sa::permute(coordinates, order);
+ * edges = sa::permute(edges, sa::edge_order(edges));
+ * ~~~
+ */
+
+#ifndef SIMD_ACCESS_RENUMBERING
+#define SIMD_ACCESS_RENUMBERING
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+
+namespace simd_access
+{
+
+///@cond
+// Calls `fn` for every node index of a connectivity entry, which is either a range or a tuple-like type.
+template<class Entry>
+inline void for_each_node(Entry&& entry, auto&& fn)
+{
+  if constexpr (std::ranges::range<Entry>)
+  {
+    for (auto&& node : entry)
+    {
+      fn(node);
+    }
+  }
+  else
+  {
+    std::apply([&](auto&&... nodes) { (fn(nodes), ...); }, entry);
+  }
+}
+
+// Compressed adjacency of a connectivity. Nodes sharing an entry are neighbors.
+struct adjacency
+{
+  std::vector<size_t> offsets_;
+  std::vector<size_t> neighbors_;
+
+  adjacency(size_t nodeCount, const auto& connectivity) :
+    offsets_(nodeCount + 1, 0)
+  {
+    auto forEachPair = [&](auto&& fn)
+      {
+        std::vector<size_t> nodes;
+        for (const auto& entry : connectivity)
+        {
+          nodes.clear();
+          for_each_node(entry, [&](auto node) { nodes.push_back(size_t(node)); });
+          for (size_t i = 0; i < nodes.size(); ++i)
+          {
+            for (size_t j = 0; j < nodes.size(); ++j)
+            {
+              if (nodes[i] != nodes[j])
+              {
+                fn(nodes[i], nodes[j]);
+              }
+            }
+          }
+        }
+      };
+    forEachPair([&](size_t a, size_t) { ++offsets_[a + 1]; });
+    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+    neighbors_.resize(offsets_.back());
+    auto fill = offsets_;
+    forEachPair([&](size_t a, size_t b) { neighbors_[fill[a]++] = b; });
+  }
+
+  size_t degree(size_t node) const { return offsets_[node + 1] - offsets_[node]; }
+};
+
+template<class Point>
+constexpr size_t point_dimension = std::tuple_size_v<Point>;
+
+// Scales the coordinates of all points to integers in [0, 2^Bits).
+template<size_t Bits, class PointRange>
+inline auto quantize(const PointRange& points)
+{
+  using Point = std::ranges::range_value_t<PointRange>;
+  constexpr auto dim = point_dimension<Point>;
+  std::array<double, dim> lower, upper;
+  lower.fill(std::numeric_limits<double>::max());
+  upper.fill(std::numeric_limits<double>::lowest());
+  for (const auto& p : points)
+  {
+    for (size_t d = 0; d < dim; ++d)
+    {
+      lower[d] = std::min(lower[d], double(p[d]));
+      upper[d] = std::max(upper[d], double(p[d]));
+    }
+  }
+  constexpr auto maxCoordinate = double((std::uint64_t(1) << Bits) - 1);
+  std::vector<std::array<std::uint32_t, dim>> result;
+  result.reserve(std::ranges::size(points));
+  for (const auto& p : points)
+  {
+    std::array<std::uint32_t, dim> q;
+    for (size_t d = 0; d < dim; ++d)
+    {
+      auto extent = upper[d] - lower[d];
+      q[d] = extent > 0 ? std::uint32_t((double(p[d]) - lower[d]) / extent * maxCoordinate) : 0;
+    }
+    result.push_back(q);
+  }
+  return result;
+}
+
+// Interleaves the bits of the coordinates, most significant bit first.
+template<size_t Bits, size_t Dim>
+inline std::uint64_t interleave_bits(const std::array<std::uint32_t, Dim>& x)
+{
+  std::uint64_t key = 0;
+  for (int bit = int(Bits) - 1; bit >= 0; --bit)
+  {
+    for (size_t d = 0; d < Dim; ++d)
+    {
+      key = (key << 1) | ((x[d] >> bit) & 1);
+    }
+  }
+  return key;
+}
+
+// Transforms coordinates to the transposed Hilbert index (J. Skilling, "Programming the Hilbert curve", 2004).
+template<size_t Bits, size_t Dim>
+inline std::array<std::uint32_t, Dim> hilbert_transpose(std::array<std::uint32_t, Dim> x)
+{
+  // inverse undo
+  for (std::uint32_t q = std::uint32_t(1) << (Bits - 1); q > 1; q >>= 1)
+  {
+    auto p = q - 1;
+    for (size_t i = 0; i < Dim; ++i)
+    {
+      if (x[i] & q)
+      {
+        x[0] ^= p;
+      }
+      else
+      {
+        auto t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  // Gray encode
+  for (size_t i = 1; i < Dim; ++i)
+  {
+    x[i] ^= x[i - 1];
+  }
+  std::uint32_t t = 0;
+  for (std::uint32_t q = std::uint32_t(1) << (Bits - 1); q > 1; q >>= 1)
+  {
+    if (x[Dim - 1] & q)
+    {
+      t ^= q - 1;
+    }
+  }
+  for (size_t i = 0; i < Dim; ++i)
+  {
+    x[i] ^= t;
+  }
+  return x;
+}
+
+// Sorts the point indices by a key computed from the quantized coordinates.
+template<class IndexType, class PointRange>
+inline std::vector<IndexType> order_by_curve(const PointRange& points, auto&& key)
+{
+  constexpr auto dim = point_dimension<std::ranges::range_value_t<PointRange>>;
+  constexpr size_t bits = std::min<size_t>(64 / dim, 32);
+  auto quantized = quantize<bits>(points);
+  std::vector<std::uint64_t> keys(quantized.size());
+  for (size_t i = 0; i < quantized.size(); ++i)
+  {
+    keys[i] = key.template operator()<bits>(quantized[i]);
+  }
+  std::vector<IndexType> order(keys.size());
+  std::iota(order.begin(), order.end(), IndexType(0));
+  std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) { return keys[a] < keys[b]; });
+  return order;
+}
+///@endcond
+
+/**
+ * Computes the Reverse Cuthill-McKee order of the nodes of a connectivity. Neighboring nodes get close indices, which
+ * minimizes the bandwidth of the adjacency matrix. Every connected component starts at a node of minimal degree.
+ * @tparam IndexType Type of the returned indices.
+ * @param nodeCount Number of nodes.
+ * @param connectivity Range of entries (edges, faces, cells), each of which is a range or tuple-like type of node
+ *   indices (e.g. `std::pair<int, int>` or `std::array<int, 4>`). All nodes of an entry are neighbors.
+ * @return The order, i.e. `order[newIndex] == oldIndex`.
+ */
+template<class IndexType = size_t>
+inline std::vector<IndexType> reverse_cuthill_mckee(size_t nodeCount, const auto& connectivity)
+{
+  adjacency graph(nodeCount, connectivity);
+  std::vector<size_t> byDegree(nodeCount);
+  std::iota(byDegree.begin(), byDegree.end(), size_t(0));
+  std::stable_sort(byDegree.begin(), byDegree.end(),
+    [&](auto a, auto b) { return graph.degree(a) < graph.degree(b); });
+  std::vector<bool> visited(nodeCount, false);
+  std::vector<IndexType> order;
+  order.reserve(nodeCount);
+  std::vector<size_t> candidates;
+  for (auto start : byDegree)
+  {
+    if (visited[start])
+    {
+      continue;
+    }
+    visited[start] = true;
+    // breadth first search, the order itself is the queue
+    auto head = order.size();
+    order.push_back(IndexType(start));
+    for (; head < order.size(); ++head)
+    {
+      auto node = size_t(order[head]);
+      candidates.clear();
+      for (auto k = graph.offsets_[node]; k < graph.offsets_[node + 1]; ++k)
+      {
+        auto neighbor = graph.neighbors_[k];
+        if (!visited[neighbor])
+        {
+          visited[neighbor] = true;
+          candidates.push_back(neighbor);
+        }
+      }
+      std::stable_sort(candidates.begin(), candidates.end(),
+        [&](auto a, auto b) { return graph.degree(a) < graph.degree(b); });
+      for (auto c : candidates)
+      {
+        order.push_back(IndexType(c));
+      }
+    }
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+/**
+ * Orders points along a Morton (Z-order) curve.
+ * @tparam IndexType Type of the returned indices.
+ * @tparam PointRange Deduced type of a random access range of points. A point is an array-like type with a
+ *   `std::tuple_size` (e.g. `std::array<double, 3>`).
+ * @param points The points (e.g. node coordinates or cell centers).
+ * @return The order, i.e. `order[newIndex] == oldIndex`.
+ */
+template<class IndexType = size_t, std::ranges::random_access_range PointRange>
+inline std::vector<IndexType> morton_order(const PointRange& points)
+{
+  return order_by_curve<IndexType>(points, []<size_t Bits>(const auto& x) { return interleave_bits<Bits>(x); });
+}
+
+/**
+ * Orders points along a Hilbert curve. Unlike the Morton curve, consecutive points on the curve are always neighbors
+ * in the grid of quantized coordinates, which gives slightly better locality.
+ * @tparam IndexType Type of the returned indices.
+ * @tparam PointRange Deduced type of a random access range of points. A point is an array-like type with a
+ *   `std::tuple_size` (e.g. `std::array<double, 3>`).
+ * @param points The points (e.g. node coordinates or cell centers).
+ * @return The order, i.e. `order[newIndex] == oldIndex`.
+ */
+template<class IndexType = size_t, std::ranges::random_access_range PointRange>
+inline std::vector<IndexType> hilbert_order(const PointRange& points)
+{
+  return order_by_curve<IndexType>(points, []<size_t Bits>(const auto& x)
+    {
+      return interleave_bits<Bits>(hilbert_transpose<Bits>(x));
+    });
+}
+
+/**
+ * Orders the entries of a connectivity by their smallest and then their largest node index. After the nodes have
+ * been renumbered, loops over the sorted entries access the nodes almost sequentially.
+ * @tparam IndexType Type of the returned indices.
+ * @param connectivity Range of entries, each of which is a range or tuple-like type of node indices.
+ * @return The order, i.e. `order[newIndex] == oldIndex`.
+ */
+template<class IndexType = size_t>
+inline std::vector<IndexType> edge_order(const auto& connectivity)
+{
+  std::vector<std::pair<size_t, size_t>> keys;
+  keys.reserve(std::ranges::size(connectivity));
+  for (const auto& entry : connectivity)
+  {
+    std::pair key(std::numeric_limits<size_t>::max(), size_t(0));
+    for_each_node(entry, [&](auto node)
+      {
+        key.first = std::min(key.first, size_t(node));
+        key.second = std::max(key.second, size_t(node));
+      });
+    keys.push_back(key);
+  }
+  std::vector<IndexType> order(keys.size());
+  std::iota(order.begin(), order.end(), IndexType(0));
+  std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) { return keys[a] < keys[b]; });
+  return order;
+}
+
+/**
+ * Inverts a permutation.
+ * @tparam IndexType Deduced index type.
+ * @param order A permutation, e.g. `order[newIndex] == oldIndex`.
+ * @return The inverse permutation, e.g. `inverse[oldIndex] == newIndex`.
+ */
+template<class IndexType>
+inline std::vector<IndexType> inverse_permutation(const std::vector<IndexType>& order)
+{
+  std::vector<IndexType> inverse(order.size());
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    inverse[size_t(order[i])] = IndexType(i);
+  }
+  return inverse;
+}
+
+/**
+ * Replaces the node indices of a connectivity by their new indices.
+ * @param connectivity Range of entries, each of which is a range or tuple-like type of node indices.
+ * @param inverse Mapping from old to new node indices (see \ref inverse_permutation).
+ */
+inline void renumber_nodes(auto& connectivity, const auto& inverse)
+{
+  for (auto& entry : connectivity)
+  {
+    for_each_node(entry, [&](auto& node) { node = std::remove_reference_t<decltype(node)>(inverse[size_t(node)]); });
+  }
+}
+
+/**
+ * Permutes a field, i.e. `result[i] = field[order[i]]`. The copy is a vectorized indirect loop. Elements, which
+ * aren't simdizable (see reflection.hpp), are copied one by one. For structure-of-arrays data call this function for
+ * every array.
+ * @tparam SimdSize Vector size of the copy loop.
+ * @tparam FieldType Deduced type of the field, e.g. `std::vector<T>` or `sa::vector<T>`.
+ * @tparam IndexType Deduced type of the indices.
+ * @param field The field.
+ * @param order The permutation, i.e. `order[newIndex] == oldIndex`.
+ * @return The permuted field.
+ */
+template<int SimdSize = stdx::native_simd<double>::size(), class FieldType, class IndexType>
+inline FieldType permute(const FieldType& field, const std::vector<IndexType>& order)
+{
+  using T = std::remove_cvref_t<decltype(field[0])>;
+  FieldType result(field.size());
+  if constexpr (requires { simdized_value<SimdSize>(std::declval<T>()); })
+  {
+    loop_with_linear_index<SimdSize>(order.begin(), order.end(), [&](auto i, auto idx)
+      {
+        SIMD_ACCESS(result, i) = SIMD_ACCESS_V(field, idx);
+      });
+  }
+  else
+  {
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+      result[i] = field[size_t(order[i])];
+    }
+  }
+  return result;
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_RENUMBERING
@@ -0,0 +1,251 @@
+// See the file "LICENSE" for the full license governing this code.
+
+/**
+ * @file
+ * @brief Vectorized prefix sums over the values computed by a loop body.
+ *
+ * The values are summed up within a vector in log2(SimdSize) steps of shifted additions and the sum of the previous
+ * vectors is carried as a broadcasted vector, which is added to all lanes. E.g. the offsets of a CSR matrix are
+ * computed from the number of entries per row by
+ * ~~~{.cpp}
+ * offsets[rows] = sa::exclusive_scan<vec_size>(0, rows, [&](auto i) { return SIMD_ACCESS_V(rowSizes, i); },
+ *   offsets.data());
+ * ~~~
+ * Since the summation order differs from a sequential loop, floating point results may differ in the last bits.
+ */
+
+#ifndef SIMD_ACCESS_SCAN
+#define SIMD_ACCESS_SCAN
+
+#include <concepts>
+#include <cstdint>
+#include <experimental/bits/simd.h>
+#include <type_traits>
+#include <vector>
+
+#include "simd_access/index.hpp"
+#include "simd_access/simd_loop.hpp"
+
+namespace simd_access
+{
+
+///@cond
+// Inclusive prefix sum of the lanes, every step adds the vector shifted by Shift lanes. The shift is written as a
+// rotation with the lanes below Shift cleared, since GCC compiles rotations into single permutations.
+template<int Shift = 1, class V>
+inline V scan_lanes(const V& x)
+{
+  if constexpr (Shift >= int(V::size()))
+  {
+    return x;
+  }
+  else
+  {
+    using T = typename V::value_type;
+    constexpr int size = V::size();
+    V shifted([&](auto lane) { return T(x[(lane + size - Shift) % size]); });
+    stdx::where(V([](auto lane) { return T(lane); }) < T(Shift), shifted) = T(0);
+    return scan_lanes<2 * Shift>(x + shifted);
+  }
+}
+
+// Prefix sum of the values returned by fn, which are written to out. Returns init plus the sum of all values.
+template<bool Exclusive, int SimdSize, class T>
+inline T scan(std::integral auto start, std::integral auto end, auto&& fn, T* out, T init)
+{
+  // the deduced ABI is the native one, whose shifts GCC compiles into permutations, see \ref math_deduced_simd
+  using SimdType = stdx::simd<T, stdx::simd_abi::deduce_t<T, SimdSize>>;
+  // the carry is kept broadcasted, so that it is added to the lane sums without a transfer to a scalar register
+  SimdType carry(init);
+  loop<SimdSize>(start, end, [&](auto i)
+    {
+      if constexpr (simd_index<decltype(i)>)
+      {
+        auto values = stdx::static_simd_cast<SimdType>(fn(i));
+        SimdType sums = scan_lanes(values) + carry;
+        if constexpr (Exclusive)
+        {
+          SimdType([&](auto lane)
+            {
+              if constexpr (lane == 0)
+              {
+                return T(carry[0]);
+              }
+              else
+              {
+                return T(sums[lane - 1]);
+              }
+            }).copy_to(out + i.index_, stdx::element_aligned);
+        }
+        else
+        {
+          sums.copy_to(out + i.index_, stdx::element_aligned);
+        }
+        carry = SimdType([&](auto) { return T(sums[SimdSize - 1]); });
+      }
+      else
+      {
+        T sum = carry[0];
+        T value = T(fn(i));
+        if constexpr (Exclusive)
+        {
+          out[i] = sum;
+        }
+        sum += value;
+        if constexpr (!Exclusive)
+        {
+          out[i] = sum;
+        }
+        carry = sum;
+      }
+    });
+  return carry[0];
+}
+
+// Two-pass prefix sum over chunks, which are processed by forEachChunk.
+template<bool Exclusive, int SimdSize, class T>
+inline T parallel_scan(std::integral auto start, std::integral auto end, auto&& fn, T* out, int chunks,
+  auto&& forEachChunk, T init)
+{
+  using IndexType = std::common_type_t<decltype(start), decltype(end)>;
+  using SimdType = stdx::fixed_size_simd<T, SimdSize>;
+  if (start >= end)
+  {
+    return init;
+  }
+  // chunk boundaries are multiples of SimdSize, so that only the last chunk has a residual loop
+  // the boundaries are computed in 64 bit, since size * c may exceed the range of the index type
+  auto size = std::uint64_t(end) - std::uint64_t(start);
+  std::vector<IndexType> chunkStart(chunks + 1);
+  for (int c = 0; c < chunks; ++c)
+  {
+    chunkStart[c] = IndexType(start) + IndexType(size * c / chunks / SimdSize * SimdSize);
+  }
+  chunkStart[chunks] = end;
+  std::vector<T> offsets(chunks + 1);
+  forEachChunk(chunks, [&](int c)
+    {
+      offsets[c + 1] = scan<Exclusive, SimdSize>(chunkStart[c], chunkStart[c + 1], fn, out, T(0));
+    });
+  offsets[0] = init;
+  for (int c = 0; c < chunks; ++c)
+  {
+    offsets[c + 1] += offsets[c];
+  }
+  forEachChunk(chunks, [&](int c)
+    {
+      if (offsets[c] != T(0))
+      {
+        loop<SimdSize>(chunkStart[c], chunkStart[c + 1], [&](auto i)
+          {
+            if constexpr (simd_index<decltype(i)>)
+            {
+              (SimdType(out + i.index_, stdx::element_aligned) + offsets[c]).copy_to(out + i.index_,
+                stdx::element_aligned);
+            }
+            else
+            {
+              out[i] += offsets[c];
+            }
+          });
+      }
+    });
+  return offsets[chunks];
+}
+///@endcond
+
+/**
+ * Inclusive prefix sum of the values computed by a loop body, i.e. `out[i] = init + fn(start) + ... + fn(i)`.
+ * @tparam SimdSize Vector size.
+ * @tparam T Deduced value type of the sums.
+ * @param start Start of the iteration range [start, end).
+ * @param end End of the iteration range [start, end).
+ * @param fn Generic function taking either `index<SimdSize, IntegralType>` or `IntegralType` and returning the
+ *   simd value or the scalar value of the index, respectively.
+ * @param out Destination array, which is indexed like the loop, i.e. the sums are written to `out[start..end)`.
+ * @param init Initial value of the sum.
+ * @return The sum of `init` and all values.
+ */
+template<int SimdSize, class T>
+inline T inclusive_scan(std::integral auto start, std::integral auto end, auto&& fn, T* out,
+  std::type_identity_t<T> init = T(0))
+{
+  return scan<false, SimdSize>(start, end, fn, out, init);
+}
+
+/**
+ * Exclusive prefix sum of the values computed by a loop body, i.e. `out[i] = init + fn(start) + ... + fn(i - 1)`.
+ * @tparam SimdSize Vector size.
+ * @tparam T Deduced value type of the sums.
+ * @param start Start of the iteration range [start, end).
+ * @param end End of the iteration range [start, end).
+ * @param fn Generic function taking either `index<SimdSize, IntegralType>` or `IntegralType` and returning the
+ *   simd value or the scalar value of the index, respectively.
+ * @param out Destination array, which is indexed like the loop, i.e. the sums are written to `out[start..end)`.
+ * @param init Initial value of the sum.
+ * @return The sum of `init` and all values, i.e. the value following the last written one.
+ */
+template<int SimdSize, class T>
+inline T exclusive_scan(std::integral auto start, std::integral auto end, auto&& fn, T* out,
+  std::type_identity_t<T> init = T(0))
+{
+  return scan<true, SimdSize>(start, end, fn, out, init);
+}
+
+/**
+ * Parallel version of \ref inclusive_scan. The range is split into `chunks` chunks. In the first pass every chunk is
+ * scanned independently, in the second pass the sum of the previous chunks is added to it. Both passes are
+ * distributed by `forEachChunk`, which is the interface to the threading system of the caller:
+ * ~~~{.cpp}
+ * sa::parallel_inclusive_scan<vec_size>(0, n, fn, out, threads, [](int chunks, auto&& body)
+ *   {
+ *     #pragma omp parallel for
+ *     for (int c = 0; c < chunks; ++c)
+ *     {
+ *       body(c);
+ *     }
+ *   });
+ * ~~~
+ * @tparam SimdSize Vector size.
+ * @tparam T Deduced value type of the sums.
+ * @param start Start of the iteration range [start, end).
+ * @param end End of the iteration range [start, end).
+ * @param fn Generic function as passed to \ref inclusive_scan. It is called once per index.
+ * @param out Destination array, which is indexed like the loop.
+ * @param chunks Number of chunks, typically the number of threads.
+ * @param forEachChunk Function taking the number of chunks and a function, which must be called for every chunk
+ *   index in `[0, chunks)` and returns after all calls completed.
+ * @param init Initial value of the sum.
+ * @return The sum of `init` and all values.
+ */
+template<int SimdSize, class T>
+inline T parallel_inclusive_scan(std::integral auto start, std::integral auto end, auto&& fn, T* out, int chunks,
+  auto&& forEachChunk, std::type_identity_t<T> init = T(0))
+{
+  return parallel_scan<false, SimdSize>(start, end, fn, out, chunks, forEachChunk, init);
+}
+
+/**
+ * Parallel version of \ref exclusive_scan. See \ref parallel_inclusive_scan for the parallelization.
+ * @tparam SimdSize Vector size.
+ * @tparam T Deduced value type of the sums.
+ * @param start Start of the iteration range [start, end).
+ * @param end End of the iteration range [start, end).
+ * @param fn Generic function as passed to \ref exclusive_scan. It is called once per index.
+ * @param out Destination array, which is indexed like the loop.
+ * @param chunks Number of chunks, typically the number of threads.
+ * @param forEachChunk Function taking the number of chunks and a function, which must be called for every chunk
+ *   index in `[0, chunks)` and returns after all calls completed.
+ * @param init Initial value of the sum.
+ * @return The sum of `init` and all values.
+ */
+template<int SimdSize, class T>
+inline T parallel_exclusive_scan(std::integral auto start, std::integral auto end, auto&& fn, T* out, int chunks,
+  auto&& forEachChunk, std::type_identity_t<T> init = T(0))
+{
+  return parallel_scan<true, SimdSize>(start, end, fn, out, chunks, forEachChunk, init);
+}
+
+} //namespace simd_access
+
+#endif //SIMD_ACCESS_SCAN
@@ -85,6 +85,20 @@ struct LValueSeparator<true>
     return &base_addr[0];
   }
 
+  /// Computes the base address of a given array for a strided simd access.
+  /**
+   * @tparam SimdSize Deduced simd size (number of vector lanes) of the access.
+   * @tparam IndexType Deduced integral type of the scalar index.
+   * @param base_addr Array base.
+   * @param i A strided simd index.
+   * @return The address of the starting array element in the element sequence defined by `i`.
+   */
+  template<int SimdSize, std::integral IndexType>
+  static auto get_base_address(auto&& base_addr, const strided_index<SimdSize, IndexType>& i)
+  {
+    return &base_addr[i.index_];
+  }
+
   /// Computes the base address of a member of array elements for an linear simd access.
   /**
    * @tparam SimdSize Deduced simd size (number of vector lanes) of the access.
@@ -100,6 +114,21 @@ struct LValueSeparator<true>
     return &subobject(base_addr[i.index_]);
   }
 
+  /// Computes the base address of a member of array elements for a strided simd access.
+  /**
+   * @tparam SimdSize Deduced simd size (number of vector lanes) of the access.
+   * @tparam IndexType Deduced integral type of the scalar index.
+   * @param base_addr Array base.
+   * @param i A strided simd index.
+   * @param subobject A functor yielding a member of the array element.
+   * @return The address of the member of the starting array element in the element sequence defined by `i`.
+   */
+  template<int SimdSize, std::integral IndexType>
+  static auto get_base_address(auto&& base_addr, const strided_index<SimdSize, IndexType>& i, auto&& subobject)
+  {
+    return &subobject(base_addr[i.index_]);
+  }
+
   /// Computes the base address of a member of array elements for an indirect simd access using indices in `stdx::simd`.
   /**
    * @tparam IndexType Deduced integral type of the scalar index.
@@ -129,6 +158,22 @@ struct LValueSeparator<true>
     return make_value_access<ElementSize>(linear_location<T, SimdSize>{base});
   }
 
+  /// Creates a value access object for a strided simd access.
+  /**
+   * @tparam ElementSize Size of an array element.
+   * @tparam T Deduced type of the simd-accessed element.
+   * @tparam SimdSize Deduced simd size (number of vector lanes) of the access.
+   * @tparam IndexType Deduced integral type of the scalar index.
+   * @param base Pointer to the first element (or one of its members) in the sequence defined by `idx`.
+   * @param idx Strided simd index.
+   * @return A value access object (see \ref value_access), which can be used as lhs in assignments.
+   */
+  template<size_t ElementSize, class T, int SimdSize, std::integral IndexType>
+  static auto get_direct_value_access(T* base, const strided_index<SimdSize, IndexType>& idx)
+  {
+    return make_value_access<ElementSize>(strided_location<T, SimdSize>{base, std::ptrdiff_t(idx.stride_)});
+  }
+
   /// Creates a value access object for an indirect simd access using indices in `stdx::simd`.
   /**
    * @tparam ElementSize Size of an array element.
@@ -8,8 +8,11 @@
 #ifndef SIMD_ACCESS_LOOP
 #define SIMD_ACCESS_LOOP
 
+#include <array>
 #include <concepts>
 #include <experimental/bits/simd.h>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 #include "simd_access/index.hpp"
 
@@ -228,6 +231,189 @@ inline void loop_with_linear_index(IteratorType start, const IteratorType& end,
   }
 }
 
+/// Counts the index vectors of a \ref classifying_loop by access path.
+struct access_statistics
+{
+  /// Number of index vectors, which were contiguous (`idx[k] == idx[0] + k`).
+  size_t contiguous = 0;
+  /// Number of index vectors with a constant stride other than one (`idx[k] == idx[0] + k * stride`).
+  size_t strided = 0;
+  /// Number of index vectors, which required a gather.
+  size_t gathered = 0;
+  /// Number of indices processed by the scalar residual loop.
+  size_t scalar = 0;
+
+  /// Returns the number of index vectors.
+  size_t vectors() const { return contiguous + strided + gathered; }
+};
+
+/**
+ * Simd-ized iteration over a function using indirect indexing, which checks the access pattern of every index vector.
+ * Contiguous index vectors are passed as linear \ref index, so that accesses become contiguous loads and stores.
+ * Index vectors with a constant stride are passed as \ref strided_index. All other index vectors are passed as
+ * `stdx::fixed_size_simd` like in the indirect \ref loop. The remainder loop is called with an integral index.
+ * The function is instantiated for all index types, which increases the code size. The check pays off, if a
+ * substantial fraction of the index vectors are contiguous (e.g. for locally ordered meshes).
+ * @tparam SimdSize Vector size.
+ * @tparam Args Optional additional template arguments passed to the function call operator.
+ * @tparam IteratorType Deduced type of the random access iterator defining the range of indices.
+ * @param start Inclusive start of the range of indices.
+ * @param end Exclusive end of the range of indices.
+ * @param fn Generic function to be called. Takes one argument, whose type is either `index<SimdSize, IntegralType>`,
+ *   `strided_index<SimdSize, IntegralType>`, `stdx::simd<IntegralType, SimdSize>` or `IntegralType` (which is
+ *   `*start`).
+ * @param statistics Optional counters, which are incremented for every index vector by the taken access path.
+ */
+template<int SimdSize, auto ... Args, std::random_access_iterator IteratorType>
+inline void classifying_loop(IteratorType start, const IteratorType& end, auto&& fn,
+  access_statistics* statistics = nullptr)
+{
+  using IndexType = std::decay_t<decltype(*start)>;
+  using StrideType = std::make_signed_t<IndexType>;
+  auto call = [&](const auto& idx)
+    {
+      if constexpr (sizeof...(Args) == 0)
+      {
+        fn(idx);
+      }
+      else
+      {
+        fn.template operator()<Args...>(idx);
+      }
+    };
+  auto count = [&](size_t access_statistics::* counter)
+    {
+      if (statistics != nullptr)
+      {
+        ++(statistics->*counter);
+      }
+    };
+  using SimdIndexType = stdx::fixed_size_simd<IndexType, SimdSize>;
+  const SimdIndexType lanes([](auto j) { return IndexType(j); });
+  size_t i = 0, i_end = end - start;
+  for (; i + SimdSize < i_end + 1; i += SimdSize)
+  {
+    SimdIndexType simd_i;
+    if constexpr (std::contiguous_iterator<IteratorType>)
+    {
+      simd_i.copy_from(std::to_address(start + i), stdx::element_aligned);
+    }
+    else
+    {
+      simd_i = SimdIndexType([&](auto j) { return *(start + i + j); });
+    }
+    auto first = IndexType(simd_i[0]);
+    if (stdx::all_of(simd_i == first + lanes))
+    {
+      count(&access_statistics::contiguous);
+      call(index<SimdSize, IndexType>{first});
+      continue;
+    }
+    // distances in the signed type, so that descending sequences are detected too
+    StrideType stride = 0;
+    if constexpr (SimdSize > 1)
+    {
+      stride = StrideType(simd_i[1]) - StrideType(first);
+    }
+    SimdIndexType progression([&](auto j) { return IndexType(first + stride * StrideType(j)); });
+    if (stdx::all_of(simd_i == progression))
+    {
+      count(&access_statistics::strided);
+      call(strided_index<SimdSize, IndexType>{first, stride});
+    }
+    else
+    {
+      count(&access_statistics::gathered);
+      call(simd_i);
+    }
+  }
+  for (; i < i_end; ++i)
+  {
+    count(&access_statistics::scalar);
+    call(*(start + i));
+  }
+}
+
+/**
+ * Software-pipelined simd-ized iteration over a function using indirect indexing. Like the indirect \ref loop, but
+ * every index vector is loaded `Distance` iterations before the function is called with it, and is passed to
+ * `prefetchFn` right after loading, which typically issues \ref prefetch for the accessed arrays. The loaded index
+ * vectors are kept in a ring, so every index vector is loaded once. Thus the index loads and the cache misses of
+ * latency-bound gathers overlap with the computation of the preceding iterations. The remainder loop is called with
+ * an integral index and isn't prefetched.
+ *
+ * The intended use is a gather from arrays larger than the last-level cache, with a dependent computation per
+ * element, which the prefetches of the following iterations overlap with. `Loop_RandomGather<Distance, 16>` measures
+ * this regime on shuffled indices (80 MB of data for 2^22 elements): the gain was 4.5% (26.6 ms to 25.4 ms, standard
+ * deviation 0.5 ms). A plain gather without computation gained 3-5%. On a virtualized machine, where page walks
+ * dominate, the difference stayed within the noise. Hence tune the depth on the target machine, and use the plain
+ * \ref loop for data, which fits into the caches.
+ * @tparam SimdSize Vector size.
+ * @tparam Distance Pipeline depth, i.e. number of iterations between the prefetch and the use of an index vector.
+ * @tparam Args Optional additional template arguments passed to the function call operator.
+ * @tparam IteratorType Deduced type of the random access iterator defining the range of indices.
+ * @param start Inclusive start of the range of indices.
+ * @param end Exclusive end of the range of indices.
+ * @param fn Generic function to be called. Takes one argument, whose type is either
+ *   `stdx::simd<IntegralType, SimdSize>` or `IntegralType` (which is `*start`).
+ * @param prefetchFn Function called with the `stdx::simd<IntegralType, SimdSize>` index vectors ahead of `fn`.
+ */
+template<int SimdSize, int Distance = 4, auto ... Args, std::random_access_iterator IteratorType>
+  requires (Distance > 0)
+inline void pipelined_loop(IteratorType start, const IteratorType& end, auto&& fn, auto&& prefetchFn)
+{
+  using IndexType = std::decay_t<decltype(*start)>;
+  using SimdIndexType = stdx::fixed_size_simd<IndexType, SimdSize>;
+  auto call = [&](const auto& idx)
+    {
+      if constexpr (sizeof...(Args) == 0)
+      {
+        fn(idx);
+      }
+      else
+      {
+        fn.template operator()<Args...>(idx);
+      }
+    };
+  auto load_indices = [&](size_t i)
+    {
+      SimdIndexType simd_i;
+      if constexpr (std::contiguous_iterator<IteratorType>)
+      {
+        simd_i.copy_from(std::to_address(start + i), stdx::element_aligned);
+      }
+      else
+      {
+        simd_i = SimdIndexType([&](auto j) { return *(start + i + j); });
+      }
+      return simd_i;
+    };
+  size_t i_end = end - start;
+  size_t vectors = i_end / SimdSize;
+  std::array<SimdIndexType, Distance> ring;
+  // prologue: the first iterations are loaded and prefetched before any work is done
+  for (size_t k = 0; k < size_t(Distance) && k < vectors; ++k)
+  {
+    ring[k] = load_indices(k * SimdSize);
+    prefetchFn(ring[k]);
+  }
+  for (size_t k = 0; k < vectors; ++k)
+  {
+    auto& slot = ring[k % Distance];
+    auto current = slot;
+    if (k + Distance < vectors)
+    {
+      slot = load_indices((k + Distance) * SimdSize);
+      prefetchFn(slot);
+    }
+    call(current);
+  }
+  for (size_t i = vectors * SimdSize; i < i_end; ++i)
+  {
+    call(*(start + i));
+  }
+}
+
 } //namespace simd_access
 
 #endif //SIMD_ACCESS_LOOP
@@ -10,9 +10,12 @@
 
 #include "simd_access/base.hpp"
 #include "simd_access/index.hpp"
+#include "simd_access/load_store.hpp"
 #include "simd_access/reflection.hpp"
 #include <utility>
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <type_traits>
 
 namespace simd_access
@@ -88,17 +91,52 @@ inline decltype(auto) generate_universal(const IndexType& idx, auto&& generator)
  * @tparam Func Deduced type of the functor specifying the subobject.
  * @param v Scalar value.
  * @param subobject Functor accessing the subobject.
- * @return The result of `subobject(v)`.
+ * @return The result of `subobject(v)`. References into a temporary `v` are returned as copies.
  */
 template<class T, class Func>
   requires(!any_simd<T>)
 inline decltype(auto) universal_access(T&& v, Func&& subobject)
 {
-  return subobject(v);
+  if constexpr (std::is_lvalue_reference_v<T>)
+  {
+    return subobject(v);
+  }
+  else
+  {
+    return std::remove_cvref_t<decltype(subobject(v))>(subobject(v));
+  }
+}
+
+/// Loads a simd value from the addresses of its lanes.
+/**
+ * If the lanes are adjacent in memory, the value is loaded contiguously, otherwise every lane is read through its own
+ * address. The addresses were just stored lane by lane, so their reload into a vector register for a hardware gather
+ * would stall on the store forwarding.
+ * @tparam SimdSize Simd size (number of vector lanes).
+ * @tparam T Deduced arithmetic type of the lanes.
+ * @param addresses Addresses of the lanes.
+ * @return A `stdx::fixed_size_simd`.
+ */
+template<int SimdSize, class T>
+  requires simd_arithmetic<std::remove_const_t<T>>
+inline auto load_addresses(const std::array<T*, SimdSize>& addresses)
+{
+  int i = 1;
+  while (i < SimdSize && addresses[i] == addresses[0] + i)
+  {
+    ++i;
+  }
+  if (i == SimdSize)
+  {
+    return load<sizeof(T)>(linear_location<T, SimdSize>{addresses[0]});
+  }
+  return stdx::fixed_size_simd<std::remove_const_t<T>, SimdSize>([&](int i) { return *addresses[i]; });
 }
 
 /// Accesses a subobject (a member or a member function) of a universal simd value. Overloaded for scalar values.
 /**
+ * If `subobject` yields an lvalue reference to an arithmetic value, the addresses of all lanes are collected and the
+ * result is loaded by \ref load_addresses. Otherwise the result is assembled lane by lane.
  * @tparam T Deduced value type of the universal simd.
  * @tparam SimdSize Simd size (number of vector lanes).
  * @tparam Func Deduced type of the functor specifying the subobject.
@@ -109,26 +147,158 @@ inline decltype(auto) universal_access(T&& v, Func&& subobject)
 template<class T, int SimdSize, class Func>
 inline auto universal_access(const simd_access::universal_simd<T, SimdSize>& v, Func&& subobject)
 {
-  using ScalarType = decltype(subobject(static_cast<const std::unwrap_reference_t<T>&>(v[0])));
-  decltype(simdized_value<SimdSize>(std::declval<ScalarType>())) result;
-  for (int i = 0; i < SimdSize; ++i)
+  using ElementType = std::unwrap_reference_t<T>;
+  using ResultType = decltype(subobject(static_cast<const ElementType&>(v[0])));
+  if constexpr (std::is_lvalue_reference_v<ResultType> && simd_arithmetic<std::remove_cvref_t<ResultType>>)
   {
-    simd_members([&](auto&& d, auto&& s)
-    { d[i] = s; },
-    result, subobject(static_cast<const std::unwrap_reference_t<T>&>(v[i])));
+    std::array<std::remove_reference_t<ResultType>*, SimdSize> addresses;
+    for (int i = 0; i < SimdSize; ++i)
+    {
+      addresses[i] = &subobject(static_cast<const ElementType&>(v[i]));
+    }
+    return load_addresses<SimdSize>(addresses);
   }
-  return result;
+  else
+  {
+    return simdized_from_lanes<std::remove_cvref_t<ResultType>, SimdSize>([&](int i, auto&& assign)
+      {
+        assign(subobject(static_cast<const ElementType&>(v[i])));
+      });
+  }
+}
+
+/// Returns the object referenced by a lane of a universal simd of pointers.
+/**
+ * @tparam T Deduced object type.
+ * @param lane Pointer to the object.
+ * @return `*lane`.
+ */
+template<class T>
+inline T& lane_object(T* lane)
+{
+  return *lane;
 }
 
+/// Returns the object referenced by a lane of a universal simd of reference wrappers.
+/**
+ * @tparam T Deduced object type.
+ * @param lane Reference wrapper of the object.
+ * @return `lane.get()`.
+ */
+template<class T>
+inline T& lane_object(std::reference_wrapper<T> lane)
+{
+  return lane.get();
+}
+
+/// Returns the object of a lane of a universal simd of objects.
+/**
+ * @tparam T Deduced object type.
+ * @param lane The object.
+ * @return `lane`.
+ */
+template<class T>
+inline T& lane_object(T& lane)
+{
+  return lane;
+}
+
+/// Accesses a member variable of the objects of all lanes of a universal simd. Overloaded for scalar values.
+/**
+ * Every lane is loaded through the address of its own object. Structure members are loaded member by member, each
+ * from its byte offset inside the member object (offsets are only taken inside the object of lane 0), unless some of
+ * their members are stored outside of the structure (see \ref members_inside), in which case they are copied lane by
+ * lane. Thus object graphs (e.g. cells pointing to faces) are traversed without copying the objects into arrays.
+ * Hardware gathers with the object addresses as 64-bit indices were measured slower than the loads of the lanes.
+ * @tparam Member Pointer to the member variable.
+ * @tparam T Deduced value type of the universal simd (an object, a pointer or a `std::reference_wrapper`).
+ * @tparam SimdSize Simd size (number of vector lanes).
+ * @param v Universal simd value.
+ * @return A simd value holding the member of `lane_object(v[i])` in lane `i`.
+ */
+template<auto Member, class T, int SimdSize>
+inline auto universal_member(const universal_simd<T, SimdSize>& v)
+{
+  using MemberType = std::remove_cvref_t<decltype(lane_object(v[0]).*Member)>;
+  if constexpr (simd_arithmetic<MemberType>)
+  {
+    return stdx::fixed_size_simd<MemberType, SimdSize>([&](int i)
+      {
+        return lane_object(v[i]).*Member;
+      });
+  }
+  else
+  {
+    const auto& member = lane_object(v[0]).*Member;
+    auto result = simdized_value<SimdSize>(member);
+    if (members_inside(member))
+    {
+      auto lane_member = [&](int i, const auto& subobject) -> decltype(auto)
+        {
+          using SubobjectType = std::remove_cvref_t<decltype(subobject)>;
+          auto offset = reinterpret_cast<const char*>(&subobject) - reinterpret_cast<const char*>(&member);
+          return *reinterpret_cast<const SubobjectType*>(
+            reinterpret_cast<const char*>(&(lane_object(v[i]).*Member)) + offset);
+        };
+      simd_members([&](auto& dest, const auto& src)
+        {
+          using SrcType = std::remove_cvref_t<decltype(src)>;
+          if constexpr (simd_arithmetic<SrcType>)
+          {
+            dest = stdx::fixed_size_simd<SrcType, SimdSize>([&](int i) { return lane_member(i, src); });
+          }
+          else
+          {
+            for (int i = 0; i < SimdSize; ++i)
+            {
+              dest[i] = lane_member(i, src);
+            }
+          }
+        }, result, member);
+    }
+    else
+    {
+      result = simdized_from_lanes<MemberType, SimdSize>([&](int i, auto&& assign)
+        {
+          assign(lane_object(v[i]).*Member);
+        });
+    }
+    return result;
+  }
+}
+
+/// Accesses a member variable of a scalar object, pointer or reference wrapper. Overloaded for universal simd values.
+/**
+ * @tparam Member Pointer to the member variable.
+ * @tparam T Deduced non-simd type of the value.
+ * @param v Scalar value.
+ * @return Reference to the member of `lane_object(v)`.
+ */
+template<auto Member, class T>
+  requires(!any_simd<T>)
+inline auto& universal_member(T& v)
+{
+  return lane_object(v).*Member;
+}
+
+/// Result type of the functor of \ref SIMD_UNIVERSAL_ACCESS for a subobject expression of type `T`.
+/**
+ * Lvalue references are preserved, everything else (in particular members of temporaries) is returned by value.
+ */
+template<class T>
+using universal_subobject_t = std::conditional_t<std::is_lvalue_reference_v<T>, T, std::remove_cvref_t<T>>;
+
 /// Generalized access of a subobject for scalar and universal simd values.
 /**
  * `SIMD_UNIVERSAL_ACCESS` replaces the expression `value expr`, if value might be a universal simd value.
+ * The functor preserves lvalue references, so that subobjects residing in memory are loaded vectorized.
  * @param value A value, which is either a scalar or a universal simd value.
  * @param expr A token sequence, which forms a valid `v expr` sequence for a scalar `v`. If `value` is a universal simd,
  *   then `v` is an entry, otherwise `v` is `value`.
  */
 #define SIMD_UNIVERSAL_ACCESS(value, expr) \
-  simd_access::universal_access(value, [&](auto&& element) { return element expr; })
+  simd_access::universal_access(value, [&](auto&& element) \
+    -> simd_access::universal_subobject_t<decltype((element expr))> { return element expr; })
 
 
 } //namespace simd_access
@@ -26,7 +26,7 @@ namespace simd_access
  * @param op Token for a binary operator (e.g. +,-,*,/).
  */
 #define VALUE_ACCESS_BIN_ASSIGNMENT_OP( op ) \
-  void operator op##=(const auto& source) && { store<ElementSize>(location_, to_simd() op source); }
+  void operator op##=(const auto& source) && { store<ElementSize>(location_, evaluate(to_simd() op source)); }
 
 /// Creates a binary assignment and a binary operator overload for a simd value access.
 /**
@@ -47,6 +47,19 @@ namespace simd_access
     return o1 op o2.to_simd(); \
   }
 
+/// Evaluates the source of an assignment to a simd access.
+/**
+ * Simd values are passed through. Expression templates (see expression.hpp) provide overloads, which evaluate the
+ * expression tree.
+ * @param value Simd value.
+ * @return `value`.
+ */
+template<class T>
+inline const T& evaluate(const T& value)
+{
+  return value;
+}
+
 /// Class representing a simd-access (read or write) to a memory location.
 /**
  * @tparam ElementSize Size of the array elements, which (or one of its members) are accessed by the simd index.
@@ -66,7 +79,7 @@ public:
    */
   void operator=(const auto& source) &&
   {
-    store<ElementSize>(location_, source);
+    store<ElementSize>(location_, evaluate(source));
   }
 
   VALUE_ACCESS_MEMBER_OPS(+)
@@ -113,6 +126,12 @@ public:
     location_(location)
   {}
 
+  /// Returns the location specification of the accessed simd variable.
+  /**
+   * @return The location.
+   */
+  const Location& location() const { return location_; }
+
 private:
   /// The location specification of the accessed simd variable.
   Location location_;
@@ -131,6 +150,119 @@ inline auto make_value_access(const Location& location)
   return value_access<Location, ElementSize>(location);
 }
 
+/// Converts the source of a masked assignment to a simd value.
+/**
+ * Expressions are evaluated (see \ref evaluate), simd accesses are loaded and arithmetic scalars are broadcasted.
+ * Simd values are passed through.
+ * @tparam Location Type of the location of the assigned simd data.
+ * @param source Source of the assignment.
+ * @return The simd value of `source`.
+ */
+template<class Location, class T>
+inline decltype(auto) masked_source(const T& source)
+{
+  decltype(auto) value = evaluate(source);
+  using ValueType = std::remove_const_t<typename Location::value_type>;
+  if constexpr (requires { value.to_simd(); })
+  {
+    return value.to_simd();
+  }
+  else if constexpr (std::is_arithmetic_v<std::remove_cvref_t<decltype(value)>> && simd_arithmetic<ValueType>)
+  {
+    return stdx::fixed_size_simd<ValueType, Location::size()>(value);
+  }
+  else
+  {
+    return value;
+  }
+}
+
+/// Creates a binary assignment operator overload for a masked simd value access.
+/**
+ * @param op Token for a binary operator (e.g. +,-,*,/).
+ */
+#define MASKED_ACCESS_BIN_ASSIGNMENT_OP( op ) \
+  void operator op##=(const auto& source) && \
+  { \
+    masked_store<ElementSize>(location_, mask_, \
+      masked_load<ElementSize>(location_, mask_) op masked_source<Location>(source)); \
+  }
+
+/// Class representing a masked simd-access to a memory location, i.e. the lhs of `where(mask, SIMD_ACCESS(...))`.
+/**
+ * Assignments read and write only the vector lanes selected by the mask. Contiguous linear accesses to arithmetic
+ * values use masked loads and stores, all other accesses branch on the mask lane by lane.
+ * @tparam M Type of the simd mask.
+ * @tparam Location Type of the location of the simd data.
+ * @tparam ElementSize Size of the array elements, which (or one of its members) are accessed by the simd index.
+ */
+template<class M, class Location, size_t ElementSize>
+class masked_access
+{
+public:
+  /// Constructor.
+  /**
+   * @param mask Simd mask.
+   * @param location The location specification of the accessed simd variable.
+   */
+  masked_access(const M& mask, const Location& location) :
+    mask_(mask),
+    location_(location)
+  {}
+
+  /// Assignment operator. Writes the selected vector lanes of a simd value.
+  /**
+   * @param source Simd value, scalar, simd access or expression, whose content is written.
+   */
+  void operator=(const auto& source) &&
+  {
+    masked_store<ElementSize>(location_, mask_, masked_source<Location>(source));
+  }
+
+  MASKED_ACCESS_BIN_ASSIGNMENT_OP(+)
+  MASKED_ACCESS_BIN_ASSIGNMENT_OP(-)
+  MASKED_ACCESS_BIN_ASSIGNMENT_OP(*)
+  MASKED_ACCESS_BIN_ASSIGNMENT_OP(/)
+
+private:
+  /// Simd mask.
+  M mask_;
+  /// The location specification of the accessed simd variable.
+  Location location_;
+};
+
+/**
+ * Returns a masked access to a memory location, which can be used as lhs of assignments.
+ * @tparam M Deduced type of the simd mask.
+ * @tparam Location Deduced type of the location of the simd data.
+ * @tparam ElementSize Deduced size of the array elements.
+ * @param mask The value of the simd mask.
+ * @param access A simd access as returned by `SIMD_ACCESS`.
+ * @return A \ref masked_access combining `mask` and `access`.
+ */
+template<class M, class Location, size_t ElementSize>
+inline auto where(const M& mask, value_access<Location, ElementSize>&& access)
+{
+  return masked_access<M, Location, ElementSize>(mask, access.location());
+}
+
+/**
+ * Prefetches the memory of a simd access into the cache hierarchy without loading it. Used together with
+ * \ref pipelined_loop to hide the latency of gathers.
+ * @tparam Location Deduced type of the location of the simd data.
+ * @tparam ElementSize Deduced size of the array elements.
+ * @tparam Locality Temporal locality hint as for `__builtin_prefetch` (0 = no reuse, 3 = keep in all cache levels).
+ * @param access A simd access as returned by `SIMD_ACCESS`.
+ */
+template<int Locality = 3, class Location, size_t ElementSize>
+inline void prefetch(const value_access<Location, ElementSize>& access)
+{
+  for (int i = 0; i < Location::size(); ++i)
+  {
+    __builtin_prefetch(&access.location().template lane<ElementSize>(i), 0, Locality);
+  }
+}
+
 VALUE_ACCESS_SCALAR_BIN_OP(+)
 VALUE_ACCESS_SCALAR_BIN_OP(-)
 VALUE_ACCESS_SCALAR_BIN_OP(*)
@@ -10,6 +10,7 @@
 
 #include <vector>
 
+#include "simd_access/allocator.hpp"
 #include "simd_access/base.hpp"
 #include "simd_access/index.hpp"
 #include "simd_access/simd_access.hpp"
@@ -58,6 +59,15 @@ struct index_operator : Base
 template<typename... Args>
 using vector = index_operator<std::vector<Args...>>;
 
+/// A shortcut type for a \ref vector of large fields.
+/**
+ * Resizing doesn't value-initialize the elements and large allocations are backed by transparent huge pages
+ * (see \ref huge_page_allocator). Usually the elements are initialized by a first write in a loop afterwards.
+ * @tparam T Value type.
+ */
+template<typename T>
+using huge_page_vector = vector<T, huge_page_allocator<T>>;
+
 } //namespace simd_access
 
 #endif //SIMD_ACCESS_VECTOR
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/access_plan.hpp"
+
+TEST(AccessPlan, Classification)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 103;
+  std::vector<size_t> indices;
+  for (int k = 0; k < vec_size; ++k)
+  {
+    indices.push_back(10 + k);
+  }
+  for (int k = 0; k < vec_size; ++k)
+  {
+    indices.push_back(80 - 2 * k);
+  }
+  for (int k = 0; k < vec_size; ++k)
+  {
+    indices.push_back(40 + (k * 7) % 13);
+  }
+  for (int k = 0; k < vec_size; ++k)
+  {
+    indices.push_back(k == vec_size - 1 ? 60 : 60 + k);
+  }
+  indices.insert(indices.end(), { 0, 1, 2 });
+
+  simd_access::access_plan<vec_size> plan(indices.begin(), indices.end());
+  ASSERT_EQ(plan.size(), indices.size());
+  ASSERT_EQ(plan.vectors(), 4);
+  EXPECT_EQ(plan.vector(0).kind, simd_access::access_kind::contiguous);
+  EXPECT_EQ(plan.vector(1).kind, simd_access::access_kind::strided);
+  EXPECT_EQ(plan.vector(1).stride, -2);
+  if constexpr (vec_size > 2)
+  {
+    EXPECT_EQ(plan.vector(2).kind, simd_access::access_kind::general);
+  }
+  EXPECT_EQ(plan.vector(3).kind, simd_access::access_kind::duplicated);
+
+  // accumulations through duplicated indices give the same result as a sequential loop
+  std::vector<double> src(size), dest(size, 0.0), expected(size, 0.0);
+  for (size_t i = 0; i < size; ++i)
+  {
+    src[i] = double(i);
+  }
+  for (int step = 0; step < 3; ++step)
+  {
+    simd_access::loop<vec_size>(plan, [&](auto i)
+      {
+        SIMD_ACCESS(dest, i) += SIMD_ACCESS(src, i) + 1.0;
+      });
+    for (auto i : indices)
+    {
+      expected[i] += src[i] + 1.0;
+    }
+  }
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(dest[i], expected[i]);
+  }
+}
+
+TEST(AccessPlan, Narrowing)
+{
+  std::vector<long> indices = { 0, 1, 1l << 40 };
+  EXPECT_THROW((simd_access::access_plan<2>(indices.begin(), indices.end())), std::out_of_range);
+  EXPECT_THROW(simd_access::narrow_indices(indices.begin(), indices.end()), std::out_of_range);
+  indices.pop_back();
+  auto narrowed = simd_access::narrow_indices(indices.begin(), indices.end());
+  static_assert(std::is_same_v<decltype(narrowed), std::vector<std::int32_t>>);
+  EXPECT_EQ(narrowed, (std::vector<std::int32_t>{ 0, 1 }));
+}
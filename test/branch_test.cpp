@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/branch.hpp"
+
+namespace {
+
+struct Flux
+{
+  double mass;
+  double energy;
+};
+
+}
+
+TEST(Branch, SkipsUniformPaths)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  // the first two vectors take a uniform path each, the third one is mixed, followed by a scalar residual
+  constexpr int size = 3 * vec_size + 1;
+  std::vector<double> values(size), result(size);
+  for (int i = 0; i < size; ++i)
+  {
+    values[i] = i < vec_size ? 1.0 : (i < 2 * vec_size ? -1.0 : (i % 2 == 0 ? 1.0 : -1.0));
+  }
+
+  int thenCalls = 0, elseCalls = 0;
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      auto v = SIMD_ACCESS_V(values, i);
+      SIMD_ACCESS(result, i) = simd_access::branch(v > 0.0,
+        [&]() { ++thenCalls; return v * 2; },
+        [&]() { ++elseCalls; return v - 10; });
+    });
+
+  for (int i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(result[i], values[i] > 0.0 ? values[i] * 2 : values[i] - 10);
+  }
+  if constexpr (vec_size > 1)
+  {
+    EXPECT_EQ(thenCalls, 3);
+    EXPECT_EQ(elseCalls, 2);
+  }
+}
+
+TEST(Branch, Structures)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  constexpr int size = 37;
+  std::vector<double> pressure(size);
+  std::vector<Flux> fluxes(size);
+  for (int i = 0; i < size; ++i)
+  {
+    pressure[i] = double(i);
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      auto p = SIMD_ACCESS_V(pressure, i);
+      using FluxType = decltype(SIMD_ACCESS_V(fluxes, i));
+      SIMD_ACCESS(fluxes, i) = simd_access::branch(p >= 20.0,
+        [&]() { return FluxType{ p, -p }; },
+        [&]() { return FluxType{ 2 * p, 0.0 * p }; });
+    });
+
+  for (int i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(fluxes[i].mass, i >= 20 ? double(i) : 2.0 * i);
+    EXPECT_EQ(fluxes[i].energy, i >= 20 ? -double(i) : 0.0);
+  }
+}
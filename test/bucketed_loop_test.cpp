@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/bucketed_loop.hpp"
+
+TEST(BucketedLoop, TypeBuckets)
+{
+  simd_access::type_buckets<3> buckets(10, 20, [](auto i) { return i % 3; });
+  EXPECT_EQ(buckets.size(0), 3);
+  EXPECT_EQ(buckets.size(1), 4);
+  EXPECT_EQ(buckets.size(2), 3);
+  EXPECT_EQ(buckets.indices(), std::vector<int>({ 12, 15, 18, 10, 13, 16, 19, 11, 14, 17 }));
+  EXPECT_EQ(*buckets.begin(1), 10);
+  EXPECT_EQ(buckets.end(2), buckets.indices().end());
+}
+
+TEST(BucketedLoop, Dispatch)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  constexpr int size = 101;
+  std::vector<int> kinds(size);
+  std::vector<double> state(size), flux(size, 0.0);
+  for (int i = 0; i < size; ++i)
+  {
+    // a contiguous block of kind 2 and scattered faces of kinds 0 and 1
+    kinds[i] = i >= 40 && i < 80 ? 2 : i % 2;
+    state[i] = double(i);
+  }
+  simd_access::type_buckets<3> buckets(0, size, [&](auto i) { return kinds[i]; });
+
+  std::vector<int> visits(size, 0);
+  for (int repetition = 0; repetition < 2; ++repetition)
+  {
+    simd_access::bucketed_loop<vec_size>(buckets, [&](auto kind, auto i)
+      {
+        constexpr int key = decltype(kind)::value;
+        auto s = SIMD_ACCESS_V(state, i);
+        if constexpr (key == 0)
+        {
+          SIMD_ACCESS(flux, i) = -s;
+        }
+        else if constexpr (key == 1)
+        {
+          SIMD_ACCESS(flux, i) = 2 * s;
+        }
+        else
+        {
+          SIMD_ACCESS(flux, i) = s + 1000;
+        }
+        simd_access::elementwise([&](auto&& idx)
+          {
+            EXPECT_EQ(kinds[idx], key);
+            ++visits[idx];
+          }, i);
+      });
+  }
+
+  for (int i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(visits[i], 2);
+    EXPECT_EQ(flux[i], kinds[i] == 0 ? -double(i) : (kinds[i] == 1 ? 2.0 * i : i + 1000.0));
+  }
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/compact.hpp"
+
+namespace
+{
+
+std::vector<double> Pressure(int size)
+{
+  std::vector<double> pressure(size);
+  for (int i = 0; i < size; ++i)
+  {
+    pressure[i] = (i * 37) % 11 < 4 ? -1.0 - i : 1.0 + i;
+  }
+  return pressure;
+}
+
+std::vector<int> NegativeIndices(const std::vector<double>& pressure, int start, int end)
+{
+  std::vector<int> result;
+  for (int i = start; i < end; ++i)
+  {
+    if (pressure[i] < 0.0)
+    {
+      result.push_back(i);
+    }
+  }
+  return result;
+}
+
+template<int SimdSize>
+void TestCompact(int start, int end)
+{
+  auto pressure = Pressure(end);
+  std::vector<int> negative(end - start);
+  auto last = simd_access::compact<SimdSize>(start, end,
+    [&](auto i) { return SIMD_ACCESS_V(pressure, i) < 0.0; }, negative.data());
+  negative.resize(last - negative.data());
+  EXPECT_EQ(negative, NegativeIndices(pressure, start, end));
+}
+
+}
+
+TEST(Compact, Linear)
+{
+  for (int end : { 0, 3, 16, 64, 101 })
+  {
+    TestCompact<4>(0, end);
+    TestCompact<8>(0, end);
+    TestCompact<16>(0, end);
+    TestCompact<32>(0, end);
+  }
+  TestCompact<16>(5, 83);
+
+  // all and none
+  auto pressure = Pressure(50);
+  std::vector<int> indices(50);
+  EXPECT_EQ(simd_access::compact<16>(0, 50, [&](auto i) { return SIMD_ACCESS_V(pressure, i) < 100.0; },
+    indices.data()), indices.data() + 50);
+  EXPECT_EQ(indices[49], 49);
+  EXPECT_EQ(simd_access::compact<16>(0, 50, [&](auto i) { return SIMD_ACCESS_V(pressure, i) > 100.0; },
+    indices.data()), indices.data());
+}
+
+TEST(Compact, IndirectLoop)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  auto pressure = Pressure(200);
+  std::vector<int> negative(pressure.size());
+  negative.resize(simd_access::compact<vec_size>(0, pressure.size(),
+    [&](auto i) { return SIMD_ACCESS_V(pressure, i) < 0.0; }, negative.data()) - negative.data());
+  simd_access::loop<vec_size>(negative.begin(), negative.end(), [&](auto i)
+    {
+      SIMD_ACCESS(pressure, i) = -SIMD_ACCESS_V(pressure, i);
+    });
+  EXPECT_TRUE(std::all_of(pressure.begin(), pressure.end(), [](auto p) { return p > 0.0; }));
+}
+
+TEST(Compact, Parallel)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  constexpr int size = 1001;
+  constexpr int threads = 4;
+  auto pressure = Pressure(size);
+  std::vector<int> negative(size);
+  std::vector<int> chunkStart(threads + 1);
+  std::vector<long> counts(threads);
+  for (int t = 0; t <= threads; ++t)
+  {
+    chunkStart[t] = t * size / threads;
+  }
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&, t]()
+      {
+        auto out = negative.data() + chunkStart[t];
+        counts[t] = simd_access::compact<vec_size>(chunkStart[t], chunkStart[t + 1],
+          [&](auto i) { return SIMD_ACCESS_V(pressure, i) < 0.0; }, out) - out;
+      });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+  auto last = negative.data() + counts[0];
+  for (int t = 1; t < threads; ++t)
+  {
+    last = std::copy_n(negative.data() + chunkStart[t], counts[t], last);
+  }
+  negative.resize(last - negative.data());
+  EXPECT_EQ(negative, NegativeIndices(pressure, 0, size));
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "simd_access/expression.hpp"
+
+TEST(Expression, Arithmetic)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 37;
+  std::vector<double> x(size), y(size), z(size), w(size);
+  std::vector<int> indices(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    x[i] = double(i);
+    y[i] = 2.0 * i;
+    w[i] = double(i);
+    indices[i] = int(size - 1 - i);
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      using simd_access::expr;
+      expr(SIMD_ACCESS(z, i)) = (expr(SIMD_ACCESS(x, i)) + 1.0) * expr(SIMD_ACCESS(y, i)) - expr(SIMD_ACCESS(x, i));
+      expr(SIMD_ACCESS(y, i)) += 3.0 * expr(SIMD_ACCESS(x, i));
+      auto idx = SIMD_ACCESS_V(indices, i);
+      expr(SIMD_ACCESS(w, idx)) -= -expr(SIMD_ACCESS(w, idx)) / 2.0;
+    });
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(z[i], (i + 1.0) * 2.0 * i - i);
+    EXPECT_EQ(y[i], 5.0 * i);
+    EXPECT_EQ(w[i], 1.5 * i);
+  }
+}
+
+TEST(Expression, Contraction)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 19;
+  // a * b + c is exactly -2^-60, but rounds to zero without fused multiply-add.
+  std::vector<double> a(size, 1.0 + std::ldexp(1.0, -30)), b(size, 1.0 - std::ldexp(1.0, -30)), c(size, -1.0);
+  std::vector<double> sum(size), difference(size), explicitFma(size), scaled(size);
+  double factor = b[0];
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      using simd_access::expr;
+      auto ea = expr(SIMD_ACCESS(a, i));
+      auto eb = expr(SIMD_ACCESS(b, i));
+      expr(SIMD_ACCESS(sum, i)) = expr(SIMD_ACCESS(c, i)) + ea * eb;
+      expr(SIMD_ACCESS(difference, i)) = ea * eb - expr(SIMD_ACCESS(c, i)) * -1.0;
+      expr(SIMD_ACCESS(explicitFma, i)) = simd_access::fma(ea, eb, expr(SIMD_ACCESS(c, i)));
+      expr(SIMD_ACCESS(scaled, i)) = ea * expr(factor) + expr(SIMD_ACCESS(c, i));
+    });
+
+  auto expected = std::fma(a[0], b[0], c[0]);
+  EXPECT_NE(expected, 0.0);
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(sum[i], expected);
+    EXPECT_EQ(difference[i], expected);
+    EXPECT_EQ(explicitFma[i], expected);
+    EXPECT_EQ(scaled[i], expected);
+  }
+}
+
+TEST(Expression, LeafAssignment)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 19;
+  std::vector<double> x(size), y(size), z(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    x[i] = i + 3.0;
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      using simd_access::expr;
+      expr(SIMD_ACCESS(y, i)) = expr(SIMD_ACCESS(x, i));
+      auto ez = expr(SIMD_ACCESS(z, i));
+      auto ey = expr(SIMD_ACCESS(y, i));
+      ez = ey;
+    });
+
+  // the residual loop covers the leaf assignment for scalar indices
+  static_assert(size % vec_size != 0);
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(y[i], i + 3.0);
+    EXPECT_EQ(z[i], i + 3.0);
+  }
+}
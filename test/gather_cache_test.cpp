@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "simd_access/gather_cache.hpp"
+
+namespace {
+
+template<class T>
+struct NodeState
+{
+  T density;
+  T velocity[2];
+};
+
+}
+
+TEST(GatherCache, EdgeLoop)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr int nodes = 41;
+  std::vector<double> values(nodes);
+  std::vector<NodeState<double>> states(nodes);
+  std::vector<int> first, second;
+  for (int i = 0; i < nodes; ++i)
+  {
+    values[i] = double(i);
+    states[i] = { double(i), { 2.0 * i, 3.0 * i } };
+    if (i + 1 < nodes)
+    {
+      first.push_back(i);
+      second.push_back(i + 1);
+    }
+  }
+  std::vector<double> differences(first.size()), momentum(first.size());
+
+  simd_access::gather_cache<double, 16> valueCache;
+  simd_access::gather_cache<NodeState<double>> stateCache;
+  simd_access::loop<vec_size>(size_t(0), first.size(), [&](auto i)
+    {
+      auto a = SIMD_ACCESS_V(first, i);
+      auto b = SIMD_ACCESS_V(second, i);
+      SIMD_ACCESS(differences, i) = valueCache.load(SIMD_ACCESS(values, b)) - valueCache.load(SIMD_ACCESS(values, a));
+      auto sa = stateCache.load(SIMD_ACCESS(states, a));
+      auto sb = stateCache.load(SIMD_ACCESS(states, b));
+      SIMD_ACCESS(momentum, i) = sa.density * sa.velocity[1] + sb.velocity[0];
+    });
+
+  for (size_t i = 0; i < first.size(); ++i)
+  {
+    EXPECT_EQ(differences[i], 1.0);
+    EXPECT_EQ(momentum[i], 3.0 * i * i + 2.0 * (i + 1));
+  }
+  // every node except the first one of each vector is gathered twice
+  auto vectorLanes = first.size() / vec_size * vec_size;
+  EXPECT_EQ(valueCache.hits() + valueCache.misses(), 2 * vectorLanes);
+  EXPECT_GT(valueCache.hit_rate(), 0.4);
+  EXPECT_EQ(valueCache.hits(), stateCache.hits());
+
+  valueCache.clear();
+  auto misses = valueCache.misses();
+  std::vector<int> index(vec_size, 3);
+  auto idx = SIMD_ACCESS_V(index, simd_access::index<vec_size>{0});
+  EXPECT_EQ(valueCache.load(SIMD_ACCESS(values, idx))[vec_size - 1], 3.0);
+  EXPECT_EQ(valueCache.misses(), misses + 1);
+
+  // a load from another array with the same indices doesn't return the cached values
+  std::vector<double> others(nodes, -1.0);
+  EXPECT_EQ(valueCache.load(SIMD_ACCESS(others, idx))[0], -1.0);
+  EXPECT_EQ(valueCache.misses(), misses + 2);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/histogram.hpp"
+
+TEST(Histogram, Counts)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  for (int size : { 0, 5, 64, 101 })
+  {
+    std::vector<double> mach(size);
+    for (int i = 0; i < size; ++i)
+    {
+      mach[i] = (i * 7 % 23) * 0.1;
+    }
+    std::vector<int> counts(3, 0), expected(3, 0);
+    for (int i = 0; i < size; ++i)
+    {
+      ++expected[int(mach[i] * 1.25)];
+    }
+    simd_access::histogram<vec_size>(0, size, [&](auto i) { return SIMD_ACCESS_V(mach, i) * 1.25; },
+      counts.data(), counts.size());
+    EXPECT_EQ(counts, expected);
+
+    // all lanes of every index vector hit the same bin
+    simd_access::histogram<vec_size>(0, size, [&](auto i) { return SIMD_ACCESS_V(mach, i) * 0.0; },
+      counts.data(), counts.size());
+    expected[0] += size;
+    EXPECT_EQ(counts, expected);
+
+    // bin indices in (-1, 0) are truncated to 0
+    simd_access::histogram<vec_size>(0, size, [&](auto i) { return SIMD_ACCESS_V(mach, i) * 1.25 - 0.5; },
+      counts.data(), counts.size());
+    for (int i = 0; i < size; ++i)
+    {
+      ++expected[int(mach[i] * 1.25 - 0.5)];
+    }
+    EXPECT_EQ(counts, expected);
+  }
+}
+
+TEST(Histogram, BinnedReduce)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  constexpr int size = 203;
+  std::vector<int> zone(size);
+  std::vector<double> volume(size);
+  std::vector<double> zoneVolume(4, 1.0), expected(4, 1.0);
+  for (int i = 0; i < size; ++i)
+  {
+    zone[i] = i < 100 ? 2 : i % 4;
+    volume[i] = double(i);
+    expected[zone[i]] += volume[i];
+  }
+  simd_access::binned_reduce<vec_size>(0, size, [&](auto i)
+    {
+      return std::pair(SIMD_ACCESS_V(zone, i), SIMD_ACCESS_V(volume, i));
+    }, zoneVolume.data(), zoneVolume.size());
+  EXPECT_EQ(zoneVolume, expected);
+
+  // per-thread bins, which are merged afterwards
+  simd_access::replicated_bins<double, vec_size> first(4), second(4);
+  simd_access::loop<vec_size>(0, 100, [&](auto i) { first.add(SIMD_ACCESS_V(zone, i), SIMD_ACCESS_V(volume, i)); });
+  simd_access::loop<vec_size>(100, size, [&](auto i)
+    {
+      second.add(SIMD_ACCESS_V(zone, i), SIMD_ACCESS_V(volume, i));
+    });
+  std::vector<double> merged(4, 1.0);
+  first.add_to(merged.data());
+  second.add_to(merged.data());
+  EXPECT_EQ(merged, expected);
+}
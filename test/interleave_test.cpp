@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/interleave.hpp"
+
+namespace {
+
+struct ChainNode
+{
+  const ChainNode* next_;
+  double value_;
+};
+
+/// Links the nodes in a random order to `chainCount` chains of equal length and returns the chain heads.
+std::vector<const ChainNode*> LinkChains(std::vector<ChainNode>& nodes, size_t chainCount)
+{
+  std::vector<size_t> order(nodes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937(1));
+  auto chainLength = nodes.size() / chainCount;
+  std::vector<const ChainNode*> heads;
+  for (size_t c = 0; c < chainCount; ++c)
+  {
+    heads.push_back(&nodes[order[c * chainLength]]);
+    for (size_t k = 0; k < chainLength; ++k)
+    {
+      auto& node = nodes[order[c * chainLength + k]];
+      node.value_ = double(c);
+      node.next_ = k + 1 < chainLength ? &nodes[order[c * chainLength + k + 1]] : nullptr;
+    }
+  }
+  return heads;
+}
+
+}
+
+TEST(Interleave, PointerChasing)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t chainCount = 3 * vec_size + 2, chainLength = 17;
+  std::vector<ChainNode> nodes(chainCount * chainLength);
+  auto heads = LinkChains(nodes, chainCount);
+
+  std::vector<double> sums(chainCount, 0.0);
+  int scalarCalls = 0;
+  simd_access::interleaved_loop<vec_size, 2>(size_t(0), chainCount, [&](auto i) -> simd_access::interleaved_task
+    {
+      scalarCalls += !simd_access::is_simd_index(i);
+      auto node = simd_access::generate_universal(i, [&](auto k) { return heads[k]; });
+      auto sum = SIMD_ACCESS(sums, i) * 1;
+      for (size_t k = 0; k < chainLength; ++k)
+      {
+        node = co_await simd_access::fetch(node);
+        sum += SIMD_UNIVERSAL_ACCESS(node, ->value_);
+        node = SIMD_UNIVERSAL_ACCESS(node, ->next_);
+      }
+      SIMD_ACCESS(sums, i) = sum;
+    });
+
+  EXPECT_EQ(scalarCalls, 2);
+  for (size_t c = 0; c < chainCount; ++c)
+  {
+    EXPECT_EQ(sums[c], c * double(chainLength));
+  }
+}
+
+TEST(Interleave, PointerAccess)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t chainCount = 2 * vec_size + 3, chainLength = 4;
+  std::vector<ChainNode> nodes(chainCount * chainLength);
+  auto heads = LinkChains(nodes, chainCount);
+
+  // linear access: advance every head by one node
+  std::vector<const ChainNode*> seconds(chainCount);
+  simd_access::loop<vec_size>(size_t(0), chainCount, [&](auto i)
+    {
+      auto node = SIMD_ACCESS_V(heads, i);
+      SIMD_ACCESS(seconds, i) = SIMD_UNIVERSAL_ACCESS(node, ->next_);
+    });
+  for (size_t c = 0; c < chainCount; ++c)
+  {
+    EXPECT_EQ(seconds[c], heads[c]->next_);
+  }
+
+  // indirect access in reversed order
+  std::vector<int> reversed(chainCount);
+  for (size_t c = 0; c < chainCount; ++c)
+  {
+    reversed[c] = int(chainCount - 1 - c);
+  }
+  std::vector<const ChainNode*> thirds(chainCount, nullptr);
+  simd_access::loop<vec_size>(size_t(0), chainCount, [&](auto i)
+    {
+      auto r = SIMD_ACCESS_V(reversed, i);
+      auto node = SIMD_ACCESS_V(seconds, r);
+      SIMD_ACCESS(thirds, r) = SIMD_UNIVERSAL_ACCESS(node, ->next_);
+    });
+  for (size_t c = 0; c < chainCount; ++c)
+  {
+    EXPECT_EQ(thirds[c], heads[c]->next_->next_);
+  }
+}
+
+TEST(Interleave, Exception)
+{
+  int completed = 0;
+  auto body = [&](simd_access::index<1, int> i) -> simd_access::interleaved_task
+    {
+      co_await simd_access::fetch(&completed);
+      if (i.index_ == 5)
+      {
+        throw std::runtime_error("failed iteration");
+      }
+      ++completed;
+    };
+  EXPECT_THROW((simd_access::interleaved_loop<1, 4>(0, 10, body)), std::runtime_error);
+  EXPECT_LT(completed, 10);
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/lazy_access.hpp"
+
+namespace {
+
+template<class T>
+struct Cell
+{
+  T pressure;
+  T velocity[3];
+  T temperature;
+};
+
+auto pressure = [](auto& c) -> auto& { return c.pressure; };
+auto velocity = [](auto& c) -> auto& { return c.velocity; };
+auto temperature = [](auto& c) -> auto& { return c.temperature; };
+
+}
+
+TEST(LazyAccess, LoadsAndStoresUsedMembersOnly)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 37;
+  std::vector<Cell<double>> cells(size);
+  std::vector<int> indices(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    cells[i] = { double(i), { 1.0, 2.0, 3.0 }, 300.0 };
+    indices[i] = int(size - 1 - i);
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      auto idx = SIMD_ACCESS_V(indices, i);
+      auto c = simd_access::lazy(SIMD_ACCESS(cells, idx));
+      EXPECT_EQ(c.is_loaded(pressure), !simd_access::is_simd_index(i));
+      auto& v = c.modify(velocity);
+      v[1] += c.get(pressure);
+      EXPECT_TRUE(c.is_loaded(pressure));
+      EXPECT_FALSE(c.is_dirty(pressure));
+      EXPECT_EQ(c.is_dirty(velocity), simd_access::is_simd_index(i));
+      c.assign(temperature, c.get(pressure) * 2);
+      EXPECT_TRUE(c.is_loaded(temperature));
+      // modifications of members, which aren't dirty, must not be overwritten
+      simd_access::elementwise([&](auto j) { cells[j].pressure = -1; }, idx);
+    });
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(cells[i].pressure, -1);
+    EXPECT_EQ(cells[i].velocity[0], 1.0);
+    EXPECT_EQ(cells[i].velocity[1], 2.0 + i);
+    EXPECT_EQ(cells[i].temperature, 2.0 * i);
+  }
+}
@@ -118,6 +118,87 @@ TEST(Loop, ResidualLoop)
 }
 
 
+TEST(Loop, ClassifyingLoop)
+{
+  TestData src(true), dest(false);
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  std::vector<int> indices;
+  for (int k = 0; k < vec_size; ++k)
+  {
+    indices.push_back(10 + k);
+  }
+  for (int k = 0; k < vec_size; ++k)
+  {
+    indices.push_back(20 + 2 * k);
+  }
+  for (int k = 0; k < vec_size; ++k)
+  {
+    indices.push_back(80 - k);
+  }
+  for (int k = 0; k < vec_size; ++k)
+  {
+    indices.push_back(40 + (k * 7) % 13);
+  }
+  indices.insert(indices.end(), { 0, 1, 2 });
+  std::vector<bool> visited(src.size, false);
+  for (auto i : indices)
+  {
+    visited[i] = true;
+  }
+
+  simd_access::access_statistics statistics;
+  simd_access::classifying_loop<vec_size>(indices.begin(), indices.end(), [&](auto i)
+    {
+      SIMD_ACCESS(dest.a, i) = SIMD_ACCESS(src.s, i, .x) + SIMD_ACCESS(src.a, i);
+      SIMD_ACCESS(dest.s, i, .y[0]) = SIMD_ACCESS(src.s, i, .y[0]) * 3;
+    }, &statistics);
+
+  for (int i = 0; i < src.size; ++i)
+  {
+    EXPECT_EQ(dest.a[i], visited[i] ? 2.0 * i : 0.0);
+    EXPECT_EQ(dest.s[i].y[0], visited[i] ? 3.0 * i : 0.0);
+  }
+  EXPECT_EQ(statistics.scalar, 3);
+  EXPECT_EQ(statistics.vectors(), 4);
+  if constexpr (vec_size > 2)
+  {
+    EXPECT_EQ(statistics.contiguous, 1);
+    EXPECT_EQ(statistics.strided, 2);
+    EXPECT_EQ(statistics.gathered, 1);
+  }
+}
+
+TEST(Loop, PipelinedLoop)
+{
+  TestData src(true), dest(false);
+  std::vector<int> indices(src.size);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::mt19937 g(1);
+  std::shuffle(indices.begin(), indices.end(), g);
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+
+  std::vector<int> prefetched, used;
+  simd_access::pipelined_loop<vec_size, 2>(indices.begin(), indices.end(), [&](auto i)
+    {
+      SIMD_ACCESS(dest.a, i) = SIMD_ACCESS(src.s, i, .x) * 2;
+      simd_access::elementwise([&](auto&& v) { used.push_back(v); }, i);
+    },
+    [&](const auto& i)
+    {
+      simd_access::prefetch(SIMD_ACCESS(src.s, i, .x));
+      simd_access::elementwise([&](auto&& v) { prefetched.push_back(v); }, i);
+    });
+
+  for (int i = 0; i < src.size; ++i)
+  {
+    EXPECT_EQ(dest.a[i], i * 2);
+  }
+  EXPECT_EQ(used, indices);
+  // every full index vector is prefetched exactly once and in order
+  auto vectorized = src.size - src.size % vec_size;
+  EXPECT_EQ(prefetched, std::vector<int>(indices.begin(), indices.begin() + vectorized));
+}
+
 TEST(Loop, AligningCopy)
 {
   TestData src(true), dest(false);
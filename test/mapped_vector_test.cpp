@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <unistd.h>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/mapped_vector.hpp"
+
+namespace {
+
+struct Point
+{
+  double x, y;
+};
+
+// Removes the temporary file at the end of a test.
+struct TempFile
+{
+  std::filesystem::path path_ = std::filesystem::temp_directory_path() /
+    ("simd_access_mapped_" + std::to_string(::getpid()) + "_" +
+     ::testing::UnitTest::GetInstance()->current_test_info()->name());
+
+  ~TempFile()
+  {
+    std::filesystem::remove(path_);
+  }
+};
+
+}
+
+TEST(MappedVector, WriteAndRead)
+{
+  static constexpr size_t size = 1003;
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  TempFile file;
+
+  {
+    simd_access::mapped_vector<double> dest(file.path_, size);
+    ASSERT_EQ(dest.size(), size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      dest[i] = i;
+    }
+    dest.advise(simd_access::access_advice::sequential);
+    simd_access::loop<vec_size>(0, size, [&](auto i)
+      {
+        dest[i] = dest[i] * 0.5;
+      });
+    dest.sync();
+  }
+  EXPECT_EQ(std::filesystem::file_size(file.path_), size * sizeof(double));
+
+  simd_access::mapped_vector<const double> src(file.path_);
+  ASSERT_EQ(src.size(), size);
+  std::vector<double> result(size);
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      SIMD_ACCESS(result, i) = src[i] * 2.0;
+    });
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(result[i], i);
+  }
+
+  std::vector<int> indices(size);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::shuffle(indices.begin(), indices.end(), std::mt19937(1));
+  src.advise(simd_access::access_advice::random);
+  std::fill(result.begin(), result.end(), 0.0);
+  simd_access::loop<vec_size>(indices.begin(), indices.end(), [&](auto i)
+    {
+      SIMD_ACCESS(result, i) = src[i] * 4.0;
+    });
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(result[i], i * 2);
+  }
+}
+
+TEST(MappedVector, Structures)
+{
+  static constexpr size_t size = 103;
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  TempFile file;
+
+  simd_access::mapped_vector<Point> points(file.path_, size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    points[i] = Point{double(i), double(i * 2)};
+  }
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      SIMD_ACCESS(points, i, .x) = SIMD_ACCESS(points, i, .x) + SIMD_ACCESS(points, i, .y);
+    });
+
+  simd_access::mapped_vector<Point> moved(std::move(points));
+  EXPECT_TRUE(points.empty());
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(moved[i].x, i * 3);
+    EXPECT_EQ(moved[i].y, i * 2);
+  }
+}
+
+TEST(MappedVector, MissingFile)
+{
+  EXPECT_THROW(simd_access::mapped_vector<const double>("/nonexistent/simd_access_file"), std::system_error);
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+
+namespace {
+
+template<class T>
+struct Limits
+{
+  T lower;
+  T upper[2];
+};
+
+}
+
+TEST(MaskedAccess, Arithmetic)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 37;
+  std::vector<double> values(size), indexed(size);
+  std::vector<int> indices(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    values[i] = double(i);
+    indexed[i] = double(i);
+    indices[i] = int(size - 1 - i);
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      using simd_access::where;
+      auto v = SIMD_ACCESS_V(values, i);
+      where(v > 10.0, SIMD_ACCESS(values, i)) = v * 2;
+      where(v < 5.0, SIMD_ACCESS(values, i)) += 100.0;
+      auto idx = SIMD_ACCESS_V(indices, i);
+      auto w = SIMD_ACCESS_V(indexed, idx);
+      where(w > 10.0, SIMD_ACCESS(indexed, idx)) -= w;
+    });
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(values[i], i > 10 ? 2.0 * i : (i < 5 ? i + 100.0 : double(i)));
+    EXPECT_EQ(indexed[i], i > 10 ? 0.0 : double(i));
+  }
+}
+
+TEST(MaskedAccess, Structures)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 37;
+  std::vector<Limits<double>> limits(size);
+  std::vector<int> indices(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    limits[i] = { double(i), { i + 1.0, i + 2.0 } };
+    indices[i] = int(size - 1 - i);
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      using simd_access::where;
+      auto idx = SIMD_ACCESS_V(indices, i);
+      auto l = SIMD_ACCESS_V(limits, idx);
+      auto mask = l.lower >= 20.0;
+      l.upper[1] = -l.lower;
+      where(mask, SIMD_ACCESS(limits, idx)) = l;
+      // member with a pitch
+      where(mask, SIMD_ACCESS(limits, idx, .lower)) *= 2.0;
+    });
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(limits[i].lower, i >= 20 ? 2.0 * i : double(i));
+    EXPECT_EQ(limits[i].upper[0], i + 1.0);
+    EXPECT_EQ(limits[i].upper[1], i >= 20 ? -double(i) : i + 2.0);
+  }
+}
+
+TEST(MaskedAccess, AccessSources)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 37;
+  std::vector<double> values(size), sums(size), other(size);
+  std::vector<Limits<double>> limits(size), copies(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    other[i] = i + 0.5;
+    limits[i] = { double(i), { i + 1.0, i + 2.0 } };
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      using simd_access::where;
+      auto mask = SIMD_ACCESS_V(other, i) > 10.0;
+      where(mask, SIMD_ACCESS(values, i)) = SIMD_ACCESS(other, i);
+      where(mask, SIMD_ACCESS(values, i)) += SIMD_ACCESS(other, i);
+      where(mask, SIMD_ACCESS(sums, i)) = SIMD_ACCESS(limits, i, .lower);
+      where(mask, SIMD_ACCESS(sums, i)) += SIMD_ACCESS(limits, i, .upper[1]);
+      where(mask, SIMD_ACCESS(copies, i)) = SIMD_ACCESS(limits, i);
+    });
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    bool selected = i + 0.5 > 10.0;
+    EXPECT_EQ(values[i], selected ? 2.0 * i + 1.0 : 0.0);
+    EXPECT_EQ(sums[i], selected ? 2.0 * i + 2.0 : 0.0);
+    EXPECT_EQ(copies[i].lower, selected ? double(i) : 0.0);
+    EXPECT_EQ(copies[i].upper[0], selected ? i + 1.0 : 0.0);
+    EXPECT_EQ(copies[i].upper[1], selected ? i + 2.0 : 0.0);
+  }
+}
+
+TEST(MaskedAccess, ScalarSources)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 37;
+  std::vector<double> values(size);
+  std::vector<int> counts(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    values[i] = double(i);
+    counts[i] = int(i);
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      using simd_access::where;
+      // limiter: clip the values to [2, 30]
+      auto v = SIMD_ACCESS_V(values, i);
+      where(v > 30.0, SIMD_ACCESS(values, i)) = 30.0;
+      where(v < 2.0, SIMD_ACCESS(values, i)) = 2;
+      where(SIMD_ACCESS_V(counts, i) % 2 == 0, SIMD_ACCESS(counts, i)) = 0;
+    });
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(values[i], std::clamp(double(i), 2.0, 30.0));
+    EXPECT_EQ(counts[i], i % 2 == 0 ? 0 : int(i));
+  }
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/math.hpp"
+
+namespace {
+
+namespace sa = simd_access;
+
+/// Error of a result in units in the last place of the exact result.
+template<class T>
+double ulp_error(T result, long double exact)
+{
+  auto rounded = T(exact);
+  if (std::isinf(rounded) || rounded == 0)
+  {
+    return result == rounded ? 0.0 : std::numeric_limits<double>::infinity();
+  }
+  T ulp = std::nextafter(std::abs(rounded), std::numeric_limits<T>::infinity()) - std::abs(rounded);
+  return double(std::abs((long double)result - exact) / ulp);
+}
+
+/// Returns the maximum error of a vectorized function over the arguments.
+template<class T, class Fn, class RefFn>
+double max_ulp_error(const std::vector<T>& x, const std::vector<T>& y, Fn&& fn, RefFn&& ref)
+{
+  constexpr int vec_size = stdx::native_simd<T>::size();
+  double result = 0;
+  for (size_t i = 0; i + vec_size <= x.size(); i += vec_size)
+  {
+    stdx::fixed_size_simd<T, vec_size> xs(&x[i], stdx::element_aligned), ys(&y[i], stdx::element_aligned);
+    auto values = fn(xs, ys);
+    for (int k = 0; k < vec_size; ++k)
+    {
+      auto error = ulp_error<T>(values[k], ref((long double)x[i + k], (long double)y[i + k]));
+      EXPECT_LE(error, 4.0) << "x = " << x[i + k] << ", y = " << y[i + k];
+      result = std::max(result, error);
+    }
+  }
+  return result;
+}
+
+template<class T>
+std::vector<T> uniform(T lower, T upper, size_t size)
+{
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<T> distribution(lower, upper);
+  std::vector<T> result(size);
+  for (auto& v : result)
+  {
+    v = distribution(generator);
+  }
+  return result;
+}
+
+template<class T>
+void test_accuracy()
+{
+  using enum sa::math_accuracy;
+  constexpr size_t size = 1 << 14;
+  constexpr T maxExp = std::is_same_v<T, double> ? 709 : 88;
+  auto expArgs = uniform<T>(-maxExp, maxExp, size);
+  auto logArgs = uniform<T>(-30, 30, size);
+  for (auto& v : logArgs)
+  {
+    v = std::exp(v);
+  }
+  auto nearOne = uniform<T>(0.5, 2, size);
+  auto exponents = uniform<T>(-40, 40, size);
+  // exponents, which yield results close to overflow and underflow
+  auto largeExponents = uniform<T>(-maxExp / 30, maxExp / 30, size);
+  auto erfArgs = uniform<T>(-7, 7, size);
+
+  auto expRef = [](long double x, long double) { return std::exp(x); };
+  auto logRef = [](long double x, long double) { return std::log(x); };
+  auto powRef = [](long double x, long double y) { return std::pow(x, y); };
+  auto erfRef = [](long double x, long double) { return std::erf(x); };
+  EXPECT_LE(max_ulp_error(expArgs, expArgs, [](auto x, auto) { return sa::exp<ulp1>(x); }, expRef), 1.0);
+  EXPECT_LE(max_ulp_error(expArgs, expArgs, [](auto x, auto) { return sa::exp<ulp4>(x); }, expRef), 4.0);
+  EXPECT_LE(max_ulp_error(logArgs, logArgs, [](auto x, auto) { return sa::log<ulp1>(x); }, logRef), 1.0);
+  EXPECT_LE(max_ulp_error(nearOne, nearOne, [](auto x, auto) { return sa::log<ulp1>(x); }, logRef), 1.0);
+  EXPECT_LE(max_ulp_error(logArgs, logArgs, [](auto x, auto) { return sa::log<ulp4>(x); }, logRef), 4.0);
+  EXPECT_LE(max_ulp_error(nearOne, exponents, [](auto x, auto y) { return sa::pow<ulp1>(x, y); }, powRef), 1.0);
+  EXPECT_LE(max_ulp_error(nearOne, exponents, [](auto x, auto y) { return sa::pow<ulp4>(x, y); }, powRef), 4.0);
+  EXPECT_LE(max_ulp_error(logArgs, largeExponents, [](auto x, auto y) { return sa::pow<ulp1>(x, y); }, powRef), 1.0);
+  EXPECT_LE(max_ulp_error(erfArgs, erfArgs, [](auto x, auto) { return sa::erf<ulp1>(x); }, erfRef), 1.0);
+  EXPECT_LE(max_ulp_error(erfArgs, erfArgs, [](auto x, auto) { return sa::erf<ulp4>(x); }, erfRef), 4.0);
+}
+
+}
+
+TEST(Math, AccuracyDouble)
+{
+  test_accuracy<double>();
+}
+
+TEST(Math, AccuracyFloat)
+{
+  test_accuracy<float>();
+}
+
+TEST(Math, SpecialValues)
+{
+  using V = stdx::fixed_size_simd<double, 8>;
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  double x[] = { 0.0, -0.0, inf, -inf, nan, 1000.0, -1000.0, 4.9e-324 };
+  double y[] = { 3.0, 3.0, -2.0, 3.0, 0.0, 0.5, 2.5, 0.5 };
+  V xs(x, stdx::element_aligned), ys(y, stdx::element_aligned);
+  auto check = [&](const V& result, auto&& ref)
+    {
+      for (int i = 0; i < 8; ++i)
+      {
+        auto expected = ref(x[i], y[i]);
+        if (std::isnan(expected))
+        {
+          EXPECT_TRUE(std::isnan(result[i])) << x[i];
+        }
+        else
+        {
+          EXPECT_EQ(result[i], expected) << x[i] << ", " << y[i];
+          EXPECT_EQ(std::signbit(result[i]), std::signbit(expected)) << x[i] << ", " << y[i];
+        }
+      }
+    };
+  check(simd_access::exp(xs), [](double v, double) { return std::exp(v); });
+  check(simd_access::log(xs), [](double v, double) { return std::log(v); });
+  check(simd_access::pow(xs, ys), [](double v, double w) { return std::pow(v, w); });
+  check(simd_access::erf(xs), [](double v, double) { return std::erf(v); });
+  // negative infinity with non-integer exponents isn't a NaN, unlike finite negative bases
+  const double negativeX[] = { -inf, -inf, -inf, -inf, -inf, -0.0, -0.0, -1.0 };
+  const double negativeY[] = { 0.5, -0.5, 3.0, -3.0, 2.5, 0.5, -3.0, 0.5 };
+  std::copy_n(negativeX, 8, x);
+  std::copy_n(negativeY, 8, y);
+  check(simd_access::pow(V(x, stdx::element_aligned), V(y, stdx::element_aligned)),
+    [](double v, double w) { return std::pow(v, w); });
+  // scalar overloads, as called for residual indices
+  EXPECT_EQ(simd_access::pow(2.0, 10), 1024.0);
+  EXPECT_EQ(simd_access::exp<simd_access::math_accuracy::ulp4>(0.0f), 1.0f);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/refill_loop.hpp"
+
+namespace {
+
+template<class T>
+struct Countdown
+{
+  T remaining;
+  T steps;
+};
+
+}
+
+TEST(RefillLoop, Countdown)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  constexpr int size = 101;
+  std::vector<Countdown<double>> elements(size);
+  size_t totalSteps = 0;
+  for (int i = 0; i < size; ++i)
+  {
+    elements[i] = Countdown<double>{double(i % 9 + 1), 0.0};
+    totalSteps += i % 9 + 1;
+  }
+
+  auto statistics = simd_access::refill_loop<vec_size>(0, size,
+    [&](const auto& i)
+    {
+      return SIMD_ACCESS(elements, i).to_simd();
+    },
+    [&](auto& state)
+    {
+      state.remaining -= 1;
+      state.steps += 1;
+      return state.remaining <= 0;
+    },
+    [&](const auto& i, const auto& state, const auto& mask)
+    {
+      simd_access::where(mask, SIMD_ACCESS(elements, i, .steps)) = state.steps;
+    });
+
+  for (int i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(elements[i].steps, i % 9 + 1);
+  }
+  EXPECT_EQ(statistics.active_lanes, totalSteps);
+  EXPECT_EQ(statistics.simd_size, vec_size);
+  // more than half of the lanes are active until the range is exhausted, then the slowest lane needs up to 9 steps
+  EXPECT_LE(statistics.steps, 2 * totalSteps / vec_size + 9);
+  EXPECT_GT(statistics.utilization(), 0.5);
+
+  // refill as soon as a single lane is inactive
+  for (auto& element : elements)
+  {
+    element.steps = 0.0;
+  }
+  auto eager = simd_access::refill_loop<vec_size, vec_size - 1>(0, size,
+    [&](const auto& i)
+    {
+      return SIMD_ACCESS(elements, i).to_simd();
+    },
+    [&](auto& state)
+    {
+      state.remaining -= 1;
+      state.steps += 1;
+      return state.remaining <= 0;
+    },
+    [&](const auto& i, const auto& state, const auto& mask)
+    {
+      simd_access::where(mask, SIMD_ACCESS(elements, i, .steps)) = state.steps;
+    });
+  for (int i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(elements[i].steps, i % 9 + 1);
+  }
+  EXPECT_EQ(eager.active_lanes, totalSteps);
+  EXPECT_GE(eager.utilization(), statistics.utilization());
+
+  auto empty = simd_access::refill_loop<vec_size>(3, 3,
+    [](const auto&) { return stdx::fixed_size_simd<double, vec_size>(0); },
+    [](auto& state) { return state == 0; },
+    [](const auto&, const auto&, const auto&) { FAIL(); });
+  EXPECT_EQ(empty.steps, 0);
+  EXPECT_EQ(empty.utilization(), 1.0);
+}
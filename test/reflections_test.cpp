@@ -66,6 +66,107 @@ inline void simd_members(auto&& func, Args&&... values)
   simd_members(func, values.y[1] ...);
 }
 
+template<class T, class VectorType = std::vector<T>>
+struct Species
+{
+  T temperature;
+  VectorType y;
+};
+
+template<int SimdSize, class T, class VectorType>
+inline auto simdized_value(const Species<T, VectorType>& s)
+{
+  using simd_access::simdized_value;
+  return Species<decltype(simdized_value<SimdSize>(s.temperature)), decltype(simdized_value<SimdSize>(s.y))>
+    { simdized_value<SimdSize>(s.temperature), simdized_value<SimdSize>(s.y) };
+}
+
+template<simd_access::specialization_of<Species>... Args>
+inline void simd_members(auto&& func, Args&&... values)
+{
+  using simd_access::simd_members;
+  simd_members(func, values.temperature ...);
+  simd_members(func, values.y ...);
+}
+
+template<class T>
+struct Jacobian
+{
+  T j[2][2];
+};
+
+template<int SimdSize, class T>
+inline auto simdized_value(const Jacobian<T>& t)
+{
+  using simd_access::simdized_value;
+  return Jacobian<decltype(simdized_value<SimdSize>(t.j[0][0]))>();
+}
+
+template<simd_access::specialization_of<Jacobian>... Args>
+inline void simd_members(auto&& func, Args&&... values)
+{
+  using simd_access::simd_members;
+  simd_members(func, values.j ...);
+}
+
+// no simdized_value and simd_members hooks:
+template<class T, class VectorType = std::vector<T>>
+struct Node
+{
+  T density;
+  T velocity[2];
+  Jacobian<T> jacobian;
+  VectorType y;
+};
+
+struct Padded
+{
+  double value;
+  float weight;
+};
+
+struct OverAligned
+{
+  double a;
+  alignas(32) double b;
+};
+
+// aggregates with base classes aren't reflected automatically, but by hooks:
+template<class T>
+struct Coordinate
+{
+  T x;
+};
+
+template<class T>
+struct Derived : Coordinate<T>
+{
+  T y;
+};
+
+template<int SimdSize, class T>
+inline auto simdized_value(const Derived<T>& d)
+{
+  using simd_access::simdized_value;
+  using SimdType = decltype(simdized_value<SimdSize>(d.y));
+  return Derived<SimdType>{ { simdized_value<SimdSize>(d.x) }, simdized_value<SimdSize>(d.y) };
+}
+
+template<simd_access::specialization_of<Derived>... Args>
+inline void simd_members(auto&& func, Args&&... values)
+{
+  using simd_access::simd_members;
+  simd_members(func, values.x ...);
+  simd_members(func, values.y ...);
+}
+
+struct Empty {};
+
+struct Tagged : Empty
+{
+  double value;
+};
+
 }
 
 
@@ -212,3 +313,159 @@ TEST(Reflections, StructuralReduction)
     EXPECT_EQ(faultdestCounter, 2);
   }
 }
+
+TEST(Reflections, VectorMember)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  for (size_t numSpecies : { size_t(3), simd_access::simdized_vector_capacity<double>::value + 2 })
+  {
+    std::vector<Species<double>> src(37), dest(37);
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+      src[i].temperature = i;
+      dest[i].y.resize(numSpecies);
+      for (size_t j = 0; j < numSpecies; ++j)
+      {
+        src[i].y.push_back(i * 100 + j);
+      }
+    }
+    // deliberately returns an rvalue:
+    struct
+    {
+      const std::vector<Species<double>>& v;
+      Species<double> operator[](size_t i) const { return v[i]; }
+    } rvalueSrc{src};
+
+    simd_access::loop<vec_size>(0, src.size(), [&](auto i)
+      {
+        auto s = SIMD_ACCESS_V(src, i);
+        auto r = SIMD_ACCESS_V(rvalueSrc, i);
+        if constexpr (simd_access::is_simd_index(i))
+        {
+          static_assert(simd_access::inline_vector_type<decltype(s.y)>);
+          static_assert(simd_access::inline_vector_type<decltype(r.y)>);
+        }
+        EXPECT_EQ(s.y.size(), numSpecies);
+        EXPECT_EQ(r.y.size(), numSpecies);
+        for (size_t j = 0; j < numSpecies; ++j)
+        {
+          s.y[j] += s.temperature + r.y[j];
+        }
+        SIMD_ACCESS(dest, i) = s;
+      });
+
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+      EXPECT_EQ(dest[i].temperature, i);
+      for (size_t j = 0; j < numSpecies; ++j)
+      {
+        EXPECT_EQ(dest[i].y[j], (i * 100 + j) * 2 + i);
+      }
+    }
+  }
+}
+
+TEST(Reflections, ArrayAndTupleMembers)
+{
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 37;
+  std::vector<std::array<double, 3>> states(size);
+  std::vector<std::tuple<double, float>> pairs(size);
+  std::vector<Jacobian<double>> jacobians(size);
+  std::vector<int> indices(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    states[i] = { double(i), i + 100.0, i + 200.0 };
+    pairs[i] = { i * 2.0, float(i) };
+    jacobians[i] = { { { 1.0, double(i) }, { 0.0, 2.0 } } };
+    indices[i] = int(size - 1 - i);
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      auto s = SIMD_ACCESS_V(states, i);
+      auto p = SIMD_ACCESS_V(pairs, i);
+      auto j = SIMD_ACCESS_V(jacobians, i);
+      if constexpr (simd_access::is_simd_index(i))
+      {
+        static_assert(std::is_same_v<decltype(s), std::array<stdx::fixed_size_simd<double, vec_size>, 3>>);
+        static_assert(std::is_same_v<decltype(std::get<1>(p)), stdx::fixed_size_simd<float, vec_size>&>);
+      }
+      s[0] = j.j[0][0] * s[0] + j.j[0][1] * std::get<0>(p);
+      s[2] += j.j[1][1] * std::get<1>(p);
+      SIMD_ACCESS(states, i) = s;
+    });
+
+  auto expected = [](size_t i) { return std::array<double, 3>{ i + i * 2.0 * i, i + 100.0, i + 200.0 + 2.0 * i }; };
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(states[i], expected(i));
+  }
+
+  std::vector<std::array<double, 3>> permuted(size);
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      auto idx = SIMD_ACCESS_V(indices, i);
+      SIMD_ACCESS(permuted, idx) = SIMD_ACCESS_V(states, idx);
+    });
+  EXPECT_EQ(permuted, states);
+}
+
+TEST(Reflections, AutomaticAggregate)
+{
+  static_assert(simd_access::aggregate_arity<Node<double>> == 4);
+  static_assert(!simd_access::aggregate_without_padding<OverAligned>);
+  static_assert(!simd_access::dense_layout<OverAligned>::value);
+  static_assert(simd_access::dense_layout<Jacobian<double>>::value);
+  static_assert(simd_access::dense_layout<Jacobian<double>>::count == 4);
+  static_assert(!simd_access::dense_layout<Padded>::value);
+  static_assert(!simd_access::dense_layout<Node<double>>::value);
+  static_assert(!simd_access::reflectable_aggregate<Derived<double>>);
+  static_assert(!simd_access::reflectable_aggregate<Tagged>);
+
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+  constexpr size_t size = 37;
+  std::vector<Node<double>> nodes(size);
+  std::vector<Padded> padded(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    nodes[i] = { double(i), { 1.0, 2.0 }, { { { 1.0, 0.0 }, { 0.0, double(i) } } }, { 0.5, 0.25, double(i) } };
+    padded[i] = { i * 2.0, float(i) };
+  }
+
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      auto n = SIMD_ACCESS_V(nodes, i);
+      // simdized to a std::tuple, since Padded isn't a template:
+      auto [value, weight] = SIMD_ACCESS_V(padded, i);
+      if constexpr (simd_access::is_simd_index(i))
+      {
+        static_assert(simd_access::specialization_of<decltype(n), Node>);
+      }
+      n.velocity[1] += n.jacobian.j[1][1] * n.density + value;
+      n.y[2] *= weight;
+      SIMD_ACCESS(nodes, i) = n;
+    });
+
+  std::vector<Derived<double>> derived(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    derived[i] = { { double(i) }, i * 3.0 };
+  }
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      auto d = SIMD_ACCESS_V(derived, i);
+      d.y += d.x;
+      SIMD_ACCESS(derived, i) = d;
+    });
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(derived[i].x, i);
+    EXPECT_EQ(derived[i].y, i * 4.0);
+    EXPECT_EQ(nodes[i].velocity[0], 1.0);
+    EXPECT_EQ(nodes[i].velocity[1], 2.0 + i * i + i * 2.0);
+    ASSERT_EQ(nodes[i].y.size(), 3);
+    EXPECT_EQ(nodes[i].y[2], i * i);
+  }
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "simd_access/renumbering.hpp"
+
+namespace {
+
+// Edges of a structured grid with randomly numbered nodes.
+struct Grid
+{
+  static constexpr int width = 23;
+  static constexpr int height = 17;
+  std::vector<int> numbering;
+  std::vector<std::pair<int, int>> edges;
+  std::vector<std::array<double, 2>> coordinates;
+
+  Grid() :
+    numbering(width * height),
+    coordinates(width * height)
+  {
+    std::iota(numbering.begin(), numbering.end(), 0);
+    std::shuffle(numbering.begin(), numbering.end(), std::mt19937(1));
+    for (int y = 0; y < height; ++y)
+    {
+      for (int x = 0; x < width; ++x)
+      {
+        coordinates[numbering[y * width + x]] = { double(x), double(y) };
+        if (x + 1 < width)
+        {
+          edges.emplace_back(numbering[y * width + x], numbering[y * width + x + 1]);
+        }
+        if (y + 1 < height)
+        {
+          edges.emplace_back(numbering[y * width + x], numbering[(y + 1) * width + x]);
+        }
+      }
+    }
+  }
+
+  static size_t bandwidth(const std::vector<std::pair<int, int>>& edges)
+  {
+    size_t result = 0;
+    for (auto [a, b] : edges)
+    {
+      result = std::max(result, size_t(std::abs(a - b)));
+    }
+    return result;
+  }
+
+  static bool is_permutation(const std::vector<size_t>& order)
+  {
+    std::vector<size_t> sorted(order);
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size(); ++i)
+    {
+      if (sorted[i] != i)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+}
+
+TEST(Renumbering, ReverseCuthillMcKee)
+{
+  Grid grid;
+  auto order = simd_access::reverse_cuthill_mckee(grid.coordinates.size(), grid.edges);
+  ASSERT_TRUE(Grid::is_permutation(order));
+  auto edges = grid.edges;
+  simd_access::renumber_nodes(edges, simd_access::inverse_permutation(order));
+  EXPECT_LE(Grid::bandwidth(edges), Grid::width + 1);
+  EXPECT_GT(Grid::bandwidth(grid.edges), 4 * Grid::width);
+
+  auto coordinates = simd_access::permute(grid.coordinates, order);
+  edges = simd_access::permute(edges, simd_access::edge_order(edges));
+  for (size_t i = 0; i < edges.size(); ++i)
+  {
+    auto [a, b] = edges[i];
+    // renumbered edges still connect grid neighbors
+    auto distance = std::abs(coordinates[a][0] - coordinates[b][0]) + std::abs(coordinates[a][1] - coordinates[b][1]);
+    EXPECT_EQ(distance, 1.0);
+    if (i > 0)
+    {
+      EXPECT_LE(std::min(edges[i - 1].first, edges[i - 1].second), std::min(a, b));
+    }
+  }
+}
+
+TEST(Renumbering, SpaceFillingCurves)
+{
+  Grid grid;
+  auto orders = { simd_access::morton_order(grid.coordinates), simd_access::hilbert_order(grid.coordinates) };
+  for (const auto& order : orders)
+  {
+    ASSERT_TRUE(Grid::is_permutation(order));
+    auto edges = grid.edges;
+    simd_access::renumber_nodes(edges, simd_access::inverse_permutation(order));
+    size_t total = 0;
+    for (auto [a, b] : edges)
+    {
+      total += std::abs(a - b);
+    }
+    // the average index distance of neighbors is much smaller than for the random numbering
+    EXPECT_LT(total / edges.size(), Grid::width * Grid::height / 8);
+  }
+  // consecutive points of the hilbert curve are grid neighbors, if the grid is a power of two
+  std::vector<std::array<double, 2>> square;
+  for (int y = 0; y < 8; ++y)
+  {
+    for (int x = 0; x < 8; ++x)
+    {
+      square.push_back({ double(x), double(y) });
+    }
+  }
+  auto order = simd_access::hilbert_order(square);
+  for (size_t i = 1; i < order.size(); ++i)
+  {
+    auto p = square[order[i - 1]], q = square[order[i]];
+    EXPECT_EQ(std::abs(p[0] - q[0]) + std::abs(p[1] - q[1]), 1.0);
+  }
+}
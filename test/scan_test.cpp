@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "simd_access/simd_access.hpp"
+#include "simd_access/scan.hpp"
+
+namespace
+{
+
+template<int SimdSize, bool Exclusive>
+void TestScan(int start, int end, int init)
+{
+  std::vector<int> sizes(end);
+  for (int i = 0; i < end; ++i)
+  {
+    sizes[i] = (i * 7) % 5;
+  }
+  std::vector<int> out(end, -1), expected(end, -1);
+  int sum = init;
+  for (int i = start; i < end; ++i)
+  {
+    expected[i] = Exclusive ? sum : sum + sizes[i];
+    sum += sizes[i];
+  }
+  auto fn = [&](auto i) { return SIMD_ACCESS_V(sizes, i); };
+  int total = Exclusive ? simd_access::exclusive_scan<SimdSize>(start, end, fn, out.data(), init) :
+    simd_access::inclusive_scan<SimdSize>(start, end, fn, out.data(), init);
+  EXPECT_EQ(total, sum);
+  EXPECT_EQ(out, expected);
+}
+
+}
+
+TEST(Scan, InclusiveExclusive)
+{
+  for (int end : { 0, 1, 8, 16, 37, 100 })
+  {
+    TestScan<4, false>(0, end, 0);
+    TestScan<8, false>(0, end, 5);
+    TestScan<16, false>(0, end, 0);
+    TestScan<4, true>(0, end, 0);
+    TestScan<8, true>(0, end, 5);
+    TestScan<16, true>(0, end, 0);
+  }
+  TestScan<8, false>(3, 50, 2);
+  TestScan<8, true>(3, 50, 2);
+}
+
+TEST(Scan, LargeValues)
+{
+  // the prefix sums stay within the range of int, although adding the index to them wouldn't
+  constexpr int size = 40;
+  constexpr int large = std::numeric_limits<int>::max() - 10;
+  std::vector<int> values(size), out(size);
+  for (int i = 0; i < size; ++i)
+  {
+    values[i] = i % 2 == 0 ? large : -large;
+  }
+  int total = simd_access::inclusive_scan<8>(0, size, [&](auto i) { return SIMD_ACCESS_V(values, i); }, out.data());
+  EXPECT_EQ(total, 0);
+  for (int i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(out[i], i % 2 == 0 ? large : 0);
+  }
+}
+
+TEST(Scan, ConvertedValues)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  std::vector<int> counts(45, 1);
+  std::vector<double> offsets(46);
+  offsets[45] = simd_access::exclusive_scan<vec_size>(0, 45,
+    [&](auto i) { return SIMD_ACCESS_V(counts, i); }, offsets.data(), 0.5);
+  for (int i = 0; i <= 45; ++i)
+  {
+    EXPECT_EQ(offsets[i], i + 0.5);
+  }
+}
+
+TEST(Scan, Parallel)
+{
+  constexpr int vec_size = stdx::native_simd<double>::size();
+  constexpr int size = 1003;
+  std::vector<double> flux(size), inclusive(size), exclusive(size);
+  for (int i = 0; i < size; ++i)
+  {
+    flux[i] = double(i % 13);
+  }
+  auto forEachChunk = [](int chunks, auto&& body)
+    {
+      std::vector<std::thread> workers;
+      for (int c = 0; c < chunks; ++c)
+      {
+        workers.emplace_back([&body, c]() { body(c); });
+      }
+      for (auto& worker : workers)
+      {
+        worker.join();
+      }
+    };
+  auto fn = [&](auto i) { return SIMD_ACCESS_V(flux, i); };
+  double inclusiveTotal = simd_access::parallel_inclusive_scan<vec_size>(0, size, fn, inclusive.data(), 4,
+    forEachChunk, 1.0);
+  double exclusiveTotal = simd_access::parallel_exclusive_scan<vec_size>(0, size, fn, exclusive.data(), 5,
+    forEachChunk, 1.0);
+  double sum = 1.0;
+  for (int i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(exclusive[i], sum);
+    sum += flux[i];
+    EXPECT_EQ(inclusive[i], sum);
+  }
+  EXPECT_EQ(inclusiveTotal, sum);
+  EXPECT_EQ(exclusiveTotal, sum);
+}
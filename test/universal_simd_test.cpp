@@ -159,3 +159,132 @@ TEST(UniversalSimdTest, Reference)
     }
   }
 }
+
+TEST(UniversalSimdTest, ValueSubobject)
+{
+  struct PointOwner
+  {
+    Point<double> p_;
+
+    Point<double> GetPoint() const { return p_; }
+  };
+
+  constexpr size_t vec_size = 4;
+  PointOwner owners[8];
+  for (int i = 0; i < 8; ++i)
+  {
+    owners[i].p_ = Point<double>{i * 1.5, i * 2.5};
+  }
+  auto generator = [&](auto i) { return owners[i]; };
+
+  {
+    auto result = simd_access::generate_universal(5, generator);
+    auto y = SIMD_UNIVERSAL_ACCESS(result, .GetPoint().y_);
+    EXPECT_EQ(y, 12.5);
+  }
+
+  {
+    stdx::fixed_size_simd<int, vec_size> index([](int i) { return 7 - 2 * i; });
+    auto y = SIMD_UNIVERSAL_ACCESS(simd_access::generate_universal(index, generator), .GetPoint().y_);
+    for (int i = 0; i < vec_size; ++i)
+    {
+      EXPECT_EQ(y[i], (7 - 2 * i) * 2.5);
+    }
+  }
+}
+
+TEST(UniversalSimdTest, AddressLoad)
+{
+  struct ValueID
+  {
+    const double* data_;
+    int idx_;
+
+    const double& GetValue() const { return data_[idx_]; }
+  };
+
+  constexpr size_t vec_size = 4;
+  double values[12];
+  for (int i = 0; i < 12; ++i)
+  {
+    values[i] = i * 1.5;
+  }
+  auto generator = [&](auto i) { return ValueID{values, int(i)}; };
+
+  {
+    auto result = simd_access::generate_universal(5, generator);
+    const auto& value = SIMD_UNIVERSAL_ACCESS(result, .GetValue());
+    EXPECT_EQ(&value, &values[5]);
+  }
+
+  {
+    // adjacent lanes are loaded contiguously
+    simd_access::index<vec_size> index{2};
+    auto valueResult = SIMD_UNIVERSAL_ACCESS(simd_access::generate_universal(index, generator), .GetValue());
+    for (int i = 0; i < vec_size; ++i)
+    {
+      EXPECT_EQ(valueResult[i], values[i + 2]);
+    }
+  }
+
+  {
+    stdx::fixed_size_simd<int, vec_size> index([](int i) { return 11 - 3 * i; });
+    auto valueResult = SIMD_UNIVERSAL_ACCESS(simd_access::generate_universal(index, generator), .GetValue());
+    for (int i = 0; i < vec_size; ++i)
+    {
+      EXPECT_EQ(valueResult[i], values[11 - 3 * i]);
+    }
+  }
+}
+
+TEST(UniversalSimdTest, PointerMember)
+{
+  struct Vec2
+  {
+    double x, y;
+  };
+  struct Face
+  {
+    int id_;
+    double area_;
+    Vec2 normal_;
+  };
+
+  constexpr size_t vec_size = 4;
+  Face faces[8];
+  for (int i = 0; i < 8; ++i)
+  {
+    faces[i] = Face{i, i * 0.5, Vec2{double(i), -double(i)}};
+  }
+  int cellFaces[vec_size] = { 6, 1, 7, 2 };
+
+  {
+    simd_access::index<vec_size> index{0};
+    auto facePtrs = simd_access::generate_universal(index, [&](auto i) { return &faces[cellFaces[i]]; });
+    auto area = simd_access::universal_member<&Face::area_>(facePtrs);
+    auto id = simd_access::universal_member<&Face::id_>(facePtrs);
+    auto normal = simd_access::universal_member<&Face::normal_>(facePtrs);
+    for (int i = 0; i < vec_size; ++i)
+    {
+      EXPECT_EQ(area[i], cellFaces[i] * 0.5);
+      EXPECT_EQ(id[i], cellFaces[i]);
+      EXPECT_EQ(std::get<0>(normal)[i], cellFaces[i]);
+      EXPECT_EQ(std::get<1>(normal)[i], -cellFaces[i]);
+    }
+  }
+
+  {
+    simd_access::index<vec_size> index{0};
+    auto faceRefs = simd_access::generate_universal(index, [&](auto i) { return std::cref(faces[cellFaces[i]]); });
+    auto area = simd_access::universal_member<&Face::area_>(faceRefs);
+    for (int i = 0; i < vec_size; ++i)
+    {
+      EXPECT_EQ(area[i], cellFaces[i] * 0.5);
+    }
+  }
+
+  {
+    auto facePtr = simd_access::generate_universal(3, [&](auto i) { return &faces[i]; });
+    EXPECT_EQ(&simd_access::universal_member<&Face::area_>(facePtr), &faces[3].area_);
+  }
+}
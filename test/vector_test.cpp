@@ -28,3 +28,37 @@ TEST(VectorTest, ArrayAdd)
     EXPECT_EQ(dest[i], i * 3);
   }
 }
+
+TEST(VectorTest, HugePageVector)
+{
+  // large enough to be allocated in huge pages
+  static constexpr size_t size = 3 * simd_access::huge_page_size / sizeof(double) + 5;
+  simd_access::huge_page_vector<double> src(size), dest;
+  dest.resize(size);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(src.data()) % simd_access::huge_page_size, 0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(dest.data()) % simd_access::huge_page_size, 0);
+
+  constexpr size_t vec_size = stdx::native_simd<double>::size();
+
+  // first touch
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      src[i] = simd_access::simd_broadcast<decltype(i)>(2.0);
+    });
+  simd_access::loop<vec_size>(0, size, [&](auto i)
+    {
+      dest[i] = src[i] * 3.0;
+    });
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    ASSERT_EQ(dest[i], 6.0);
+  }
+
+  // small allocations and explicit values
+  simd_access::huge_page_vector<int> small(10, 7);
+  small.push_back(8);
+  EXPECT_EQ(small.size(), 11);
+  EXPECT_EQ(small[9], 7);
+  EXPECT_EQ(small[10], 8);
+}